@@ -0,0 +1,1479 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Benchmarks for the basic `Ellipse` API.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        ellipse.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file measures the constructors, all getters and setters as well
+ * as the evaluation of the `Ellipse` class.  Batch kernels are measured for
+ * batches of 1024 parameter values.  The batch evaluation is measured for each
+ * trigonometric backend.  Offset curves are measured for both inner
+ * and outer offsets as well as for 16 passes of a tool path.  The rasterisation is measured for images of 1024 times
+ * 1024 pixels, anti-aliased coverage and signed distance fields for 100000
+ * ellipses at 4K resolution.  The perspective projection is measured for single
+ * ellipses and batches of 1024 ellipses, as are the conversions from and to
+ * conics.  Affine transformations are measured for 1024 ellipses on a single
+ * thread and for 1048576 ellipses on all cores.  Kepler's equation is solved
+ * for single mean anomalies and batches of 1024 mean anomalies.  The orbit
+ * propagation advances 1048576 bodies on all cores.  The inverse
+ * parametrisation is measured for single points and batches of 1024 points,
+ * both with and without the refinement to the closest curve point.  The points
+ * are placed on an off-centre, rotated ellipse by `eval_world`.  The uniform
+ * sampling within and on ellipses draws 1048576 points on all cores.
+ * Lazy streams are measured by iterating 1024 points.  The batch evaluation
+ * by the C interface is measured for contiguous and interleaved arrays.  Scenes
+ * of 100000 ellipses are created and destroyed on the global heap as well as
+ * within an arena.  Reads of shared ellipses are compared with reads guarded by
+ * a mutex.  Bursts of setter calls followed by a query are measured for each
+ * caching mode.  Scenes of 4096 ellipses with 112 distinct shapes are
+ * tessellated with and without a cache of shapes.  The minimum-volume
+ * enclosing ellipse is determined for 1048576 points sampled within an ellipse
+ * on all cores.  Batches of 1024 ellipses are converted into rational
+ * quadratic segments, which are then evaluated for 1024 parameters covering
+ * the whole ellipse.  Batches of 1024 rays, lines and planes are intersected
+ * with a tilted ellipse.  The intersection over union is measured for 1024
+ * pairs of overlapping ellipses.  The non-maximum suppression deduplicates
+ * 100000 candidates around 10000 objects at 4K resolution on all cores.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "harness.hpp"
+
+#include "../lib/Ellipse.hpp"
+#include "../lib/ellipse_c.h"
+
+#include <mutex>
+
+
+
+/*
+ * Batch settings.
+ */
+
+static const size_t batch   {0x400};
+
+static vector <float> parameters (void)
+{
+    vector <float>  ret (batch);
+
+    for (size_t i = 0x0; i < batch; i++)
+        ret[i] = float (i) * 6.2831853f / float (batch);
+
+    return ret;
+}
+
+
+
+/*
+ * Construction.
+ */
+
+BENCHMARK (ctor_default)
+{
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse ellipse {};
+        keep (ellipse);
+    };
+}
+
+BENCHMARK (ctor_parametric)
+{
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+        keep (ellipse);
+    };
+}
+
+
+
+/*
+ * Scalar getters and setters.
+ */
+
+BENCHMARK (set_get_eccentricity)
+{
+    Ellipse ellipse {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.set_eccentricity (float (i));
+        keep (ellipse.get_eccentricity ());
+    };
+}
+
+BENCHMARK (set_get_major)
+{
+    Ellipse ellipse {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.set_major (float (i));
+        keep (ellipse.get_major ());
+    };
+}
+
+BENCHMARK (set_get_minor)
+{
+    Ellipse ellipse {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.set_minor (float (i));
+        keep (ellipse.get_minor ());
+    };
+}
+
+BENCHMARK (set_get_radius)
+{
+    Ellipse ellipse {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.set_radius (float (i));
+        keep (ellipse.get_radius ());
+    };
+}
+
+
+
+/*
+ * Vector getters and setters.
+ */
+
+BENCHMARK (set_get_centre)
+{
+    Ellipse ellipse {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.set_centre (float (i), 1.f, 2.f);
+        keep (ellipse.get_centre ());
+    };
+}
+
+BENCHMARK (set_get_normal)
+{
+    Ellipse ellipse {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.set_normal (0.f, 0.f, float (i));
+        keep (ellipse.get_normal ());
+    };
+}
+
+BENCHMARK (set_get_tangent)
+{
+    Ellipse ellipse {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.set_tangent (float (i), 0.f, 0.f);
+        keep (ellipse.get_tangent ());
+    };
+}
+
+
+
+/*
+ * Parametrisation getters.
+ */
+
+BENCHMARK (get_x)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.get_x () (float (i)));
+}
+
+BENCHMARK (get_y)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.get_y () (float (i)));
+}
+
+BENCHMARK (get_z)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.get_z () (float (i)));
+}
+
+
+
+/*
+ * Evaluation.
+ */
+
+BENCHMARK (eval)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.eval (float (i) * 1e-3f));
+}
+
+BENCHMARK (eval_offset)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.eval (float (i) * 1e-3f, 0.5f));
+}
+
+
+
+/*
+ * Derivatives, frames and curvature.
+ */
+
+BENCHMARK (eval_derivative)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.eval_derivative (float (i) * 1e-3f));
+}
+
+BENCHMARK (eval_frame)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.eval_frame (float (i) * 1e-3f));
+}
+
+BENCHMARK (eval_curvature)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.eval_curvature (float (i) * 1e-3f));
+}
+
+
+
+/*
+ * Batch kernels.
+ */
+
+BENCHMARK (eval_batch_1024)
+{
+    Ellipse                 ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const vector <float>    t   {parameters ()};
+    vector <float>          x   (batch);
+    vector <float>          y   (batch);
+    vector <float>          z   (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.eval (t.data (), batch, x.data (), y.data (), z.data ());
+        keep (x);
+    };
+}
+
+BENCHMARK (eval_polynomial3_batch_1024)
+{
+    Ellipse                 ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const vector <float>    t       {parameters ()};
+    const Trig              trig    (Trig :: polynomial, 0x3);
+    vector <float>          x       (batch);
+    vector <float>          y       (batch);
+    vector <float>          z       (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.eval    ( t.data (), batch, x.data (), y.data (), z.data ()
+                        , trig
+                        );
+        keep (x);
+    };
+}
+
+BENCHMARK (eval_polynomial5_batch_1024)
+{
+    Ellipse                 ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const vector <float>    t       {parameters ()};
+    const Trig              trig    (Trig :: polynomial, 0x5);
+    vector <float>          x       (batch);
+    vector <float>          y       (batch);
+    vector <float>          z       (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.eval    ( t.data (), batch, x.data (), y.data (), z.data ()
+                        , trig
+                        );
+        keep (x);
+    };
+}
+
+BENCHMARK (eval_table_batch_1024)
+{
+    Ellipse                 ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const vector <float>    t       {parameters ()};
+    const Trig              trig    (Trig :: table, 0x0);
+    vector <float>          x       (batch);
+    vector <float>          y       (batch);
+    vector <float>          z       (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.eval    ( t.data (), batch, x.data (), y.data (), z.data ()
+                        , trig
+                        );
+        keep (x);
+    };
+}
+
+BENCHMARK (eval_derivative_batch_1024)
+{
+    Ellipse                 ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const vector <float>    t   {parameters ()};
+    vector <float>          x   (batch);
+    vector <float>          y   (batch);
+    vector <float>          z   (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.eval_derivative
+            (t.data (), batch, 0x1, x.data (), y.data (), z.data ());
+        keep (x);
+    };
+}
+
+BENCHMARK (eval_curvature_batch_1024)
+{
+    Ellipse                 ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const vector <float>    t   {parameters ()};
+    vector <float>          k   (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.eval_curvature (t.data (), batch, k.data ());
+        keep (k);
+    };
+}
+
+BENCHMARK (eval_frame_batch_1024)
+{
+    Ellipse                 ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const vector <float>    t       {parameters ()};
+    vector <float>          buffer  (0xa * batch);
+    Ellipse :: Frames       frames  {};
+
+    for (size_t i = 0x0; i < 0x3; i++)
+    {
+        frames.position[i]  = & buffer[i * batch];
+        frames.tangent[i]   = & buffer[(0x3 + i) * batch];
+        frames.normal[i]    = & buffer[(0x6 + i) * batch];
+    };
+
+    frames.curvature    = & buffer[0x9 * batch];
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.eval_frame (t.data (), batch, frames);
+        keep (buffer);
+    };
+}
+
+
+
+/*
+ * Offset curves.
+ */
+
+BENCHMARK (offset_curve)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.eval_offset (float (i) * 1e-3f, 0.5f));
+}
+
+BENCHMARK (offset_curve_batch_1024x16)
+{
+    Ellipse                 ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const vector <float>    t           {parameters ()};
+    vector <float>          distances   (0x10);
+    vector <float>          x           (0x10 * batch);
+    vector <float>          y           (0x10 * batch);
+    vector <float>          z           (0x10 * batch);
+
+    for (size_t i = 0x0; i < distances.size (); i++)
+        distances[i] = 0.1f * float (i) - 0.5f;
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.eval_offset ( t.data (), batch, distances.data (), 0x10
+                            , x.data (), y.data (), z.data ()
+                            );
+        keep (x);
+    };
+}
+
+BENCHMARK (tessellate_offset_inner)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    vector <float>  x   {};
+    vector <float>  y   {};
+    vector <float>  z   {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        keep (ellipse.tessellate_offset (-0.75f, 1e-3f, x, y, z));
+        keep (x);
+    };
+}
+
+BENCHMARK (tessellate_offset_outer)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    vector <float>  x   {};
+    vector <float>  y   {};
+    vector <float>  z   {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        keep (ellipse.tessellate_offset (0.75f, 1e-3f, x, y, z));
+        keep (x);
+    };
+}
+
+BENCHMARK (tessellate_offset_passes_16)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    vector <float>  distances   (0x10);
+    vector <size_t> counts      (0x10);
+    vector <float>  x           {};
+    vector <float>  y           {};
+    vector <float>  z           {};
+
+    for (size_t i = 0x0; i < distances.size (); i++)
+        distances[i] = 0.1f * float (i) - 0.75f;
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        keep    (ellipse.tessellate_offset  ( distances.data (), 0x10, 1e-3f
+                                            , x, y, z, counts.data ()
+                                            ));
+        keep (x);
+    };
+}
+
+
+
+/*
+ * Rasterisation.
+ */
+
+static const size_t image   {0x400};
+
+static vector <Ellipse> scatter ( const size_t count
+                                , const size_t width
+                                , const size_t height
+                                )
+{
+    vector <Ellipse>    ret {};
+
+    ret.reserve (count);
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const float angle   {float (i) * 0.1f};
+
+        ret.emplace_back    ( float (i % 0x10) + 2.f
+                            , float (i % 0x7)
+                            , float ((i * 0x9e5) % width)
+                            , float ((i * 0x3b1) % height)
+                            , 0.f
+                            , cos (angle)
+                            , sin (angle)
+                            , 0.f
+                            , 0.f
+                            , 0.f
+                            , 1.f
+                            );
+    };
+
+    return ret;
+}
+
+BENCHMARK (rasterise_fill_1024)
+{
+    Ellipse                 ellipse
+        (300.f, 150.f, 512.f, 512.f, 0.f, 1.f, 1.f, 0.f, 0.f, 0.f, 1.f);
+    vector <unsigned char>  pixels  (image * image);
+    const Ellipse :: Image  target  {pixels.data (), image, image, image, 0x8};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.rasterise (target, Ellipse :: fill, 0xff);
+        keep (pixels);
+    };
+}
+
+BENCHMARK (rasterise_outline_1024)
+{
+    Ellipse                 ellipse
+        (300.f, 150.f, 512.f, 512.f, 0.f, 1.f, 1.f, 0.f, 0.f, 0.f, 1.f);
+    vector <unsigned char>  pixels  (image * image);
+    const Ellipse :: Image  target  {pixels.data (), image, image, image, 0x8};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.rasterise (target, Ellipse :: outline, 0xff);
+        keep (pixels);
+    };
+}
+
+BENCHMARK (rasterise_batch_10000)
+{
+    const vector <Ellipse>  ellipses    {scatter (0x2710, image, image)};
+    vector <uint32_t>       values      (ellipses.size ());
+    vector <uint32_t>       pixels      (image * image);
+    const Ellipse :: Image  target
+        {pixels.data (), image, image, image * sizeof (uint32_t), 0x20};
+
+    for (size_t i = 0x0; i < values.size (); i++)
+        values[i] = uint32_t (i);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse :: rasterise    ( ellipses.data (), ellipses.size (), target
+                                , Ellipse :: fill, values.data (), 0x0
+                                );
+        keep (pixels);
+    };
+}
+
+BENCHMARK (coverage_4k_100000)
+{
+    const vector <Ellipse>  ellipses    {scatter (0x186a0, 0xf00, 0x870)};
+    vector <float>          pixels      (0xf00 * 0x870);
+    const Ellipse :: Image  target
+        {pixels.data (), 0xf00, 0x870, 0xf00 * sizeof (float), 0x20};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse :: rasterise    ( ellipses.data (), ellipses.size (), target
+                                , Ellipse :: coverage, nullptr, 0x0
+                                );
+        keep (pixels);
+    };
+}
+
+BENCHMARK (distance_4k_100000)
+{
+    const vector <Ellipse>  ellipses    {scatter (0x186a0, 0xf00, 0x870)};
+    vector <float>          pixels      (0xf00 * 0x870, 1e9f);
+    const Ellipse :: Image  target
+        {pixels.data (), 0xf00, 0x870, 0xf00 * sizeof (float), 0x20};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse :: rasterise    ( ellipses.data (), ellipses.size (), target
+                                , Ellipse :: distance, nullptr, 0x0
+                                );
+        keep (pixels);
+    };
+}
+
+
+
+/*
+ * Projection.
+ */
+
+static Ellipse :: Batch arrays (vector <float> & storage)
+{
+    Ellipse :: Batch    ret {};
+
+    for (size_t i = 0x0; i < 0x3; i++)
+    {
+        ret.centre[i]   = & storage[i * batch];
+        ret.tangent[i]  = & storage[(0x3 + i) * batch];
+        ret.normal[i]   = & storage[(0x6 + i) * batch];
+    };
+
+    ret.major   = & storage[0x9 * batch];
+    ret.minor   = & storage[0xa * batch];
+
+    return ret;
+}
+
+static void fill (const Ellipse :: Batch & ellipses)
+{
+    for (size_t i = 0x0; i < batch; i++)
+    {
+        ellipses.centre[0x0][i]     = float (i % 0x20) * 0.1f - 1.6f;
+        ellipses.centre[0x1][i]     = float (i / 0x20) * 0.1f - 1.6f;
+        ellipses.tangent[0x0][i]    = 1.f;
+        ellipses.tangent[0x1][i]    = float (i) * 1e-3f;
+        ellipses.normal[0x0][i]     = 0.1f;
+        ellipses.normal[0x2][i]     = 1.f;
+        ellipses.major[i]           = 0.05f;
+        ellipses.minor[i]           = 0.03f;
+    };
+
+    return;
+}
+
+static const float camera   [0xc]
+    { 800.f, 0.f, 640.f, 3200.f
+    , 0.f, 800.f, 360.f, 1800.f
+    , 0.f, 0.f, 1.f, 5.f
+    };
+
+BENCHMARK (project)
+{
+    Ellipse ellipse (0.5f, 0.5f, 0.f, 0.f, 0.f, 1.f, 0.2f, 0.f, 0.f, 0.f, 1.f);
+    Ellipse image   {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        keep (ellipse.project (camera, image));
+        keep (image);
+    };
+}
+
+BENCHMARK (project_batch_1024)
+{
+    vector <float>      input       (0xb * batch);
+    vector <float>      output      (0xb * batch);
+    Ellipse :: Batch    ellipses    {arrays (input)};
+    Ellipse :: Batch    images      {arrays (output)};
+
+    fill (ellipses);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        keep (Ellipse :: project (camera, ellipses, batch, images));
+        keep (output);
+    };
+}
+
+
+
+/*
+ * Conics.
+ */
+
+BENCHMARK (get_conic)
+{
+    Ellipse ellipse (0.5f, 0.5f, 0.f, 0.f, 0.f, 1.f, 0.2f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.get_conic ());
+}
+
+BENCHMARK (get_conic_cached)
+{
+    Ellipse ellipse (0.5f, 0.5f, 0.f, 0.f, 0.f, 1.f, 0.2f, 0.f, 0.f, 0.f, 1.f);
+
+    ellipse.cache_conic ();
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.get_conic ());
+}
+
+BENCHMARK (to_conic_batch_1024)
+{
+    vector <float>      input       (0xb * batch);
+    vector <Conic>      conics      (batch);
+    Ellipse :: Batch    ellipses    {arrays (input)};
+
+    fill (ellipses);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse :: to_conic (ellipses, batch, conics.data ());
+        keep (conics);
+    };
+}
+
+BENCHMARK (from_conic_batch_1024)
+{
+    vector <float>      input       (0xb * batch);
+    vector <float>      output      (0xb * batch);
+    vector <Conic>      conics      (batch);
+    Ellipse :: Batch    ellipses    {arrays (input)};
+    Ellipse :: Batch    results     {arrays (output)};
+
+    fill (ellipses);
+    Ellipse :: to_conic (ellipses, batch, conics.data ());
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        keep (Ellipse :: from_conic (conics.data (), batch, results));
+        keep (output);
+    };
+}
+
+
+
+/*
+ * Affine transformations.
+ */
+
+static const float affine   [0xc]
+    { 1.2f, 0.3f, 0.f, 0.5f
+    , 0.f, 0.8f, 0.1f, -0.2f
+    , 0.f, 0.f, 1.f, 0.f
+    };
+
+BENCHMARK (transform_batch_1024)
+{
+    vector <float>      input       (0xb * batch);
+    vector <float>      output      (0xb * batch);
+    Ellipse :: Batch    ellipses    {arrays (input)};
+    Ellipse :: Batch    results     {arrays (output)};
+
+    fill (ellipses);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse :: transform (affine, ellipses, batch, results, 0x1);
+        keep (output);
+    };
+}
+
+BENCHMARK (transform_batch_1048576)
+{
+    const size_t        count       {0x400 * batch};
+    vector <float>      storage     (0xb * count);
+    Ellipse :: Batch    ellipses    {};
+
+    for (size_t i = 0x0; i < 0x3; i++)
+    {
+        ellipses.centre[i]  = & storage[i * count];
+        ellipses.tangent[i] = & storage[(0x3 + i) * count];
+        ellipses.normal[i]  = & storage[(0x6 + i) * count];
+    };
+
+    ellipses.major  = & storage[0x9 * count];
+    ellipses.minor  = & storage[0xa * count];
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        ellipses.tangent[0x0][i]    = 1.f;
+        ellipses.normal[0x2][i]     = 1.f;
+        ellipses.major[i]           = 0.05f;
+        ellipses.minor[i]           = 0.03f;
+    };
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse :: transform (affine, ellipses, count, ellipses, 0x0);
+        keep (storage);
+    };
+}
+
+
+
+/*
+ * Orbits.
+ */
+
+BENCHMARK (kepler)
+{
+    float   mean    {0.3f};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        mean = Ellipse :: kepler (mean, 0.6f) - 0.3f;
+        keep (mean);
+    };
+}
+
+BENCHMARK (kepler_batch_1024)
+{
+    vector <float>  mean            {parameters ()};
+    vector <float>  eccentricity    (batch, 0.6f);
+    vector <float>  anomaly         (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse :: kepler   ( mean.data ()
+                            , eccentricity.data ()
+                            , batch
+                            , anomaly.data ()
+                            );
+        keep (anomaly);
+    };
+}
+
+BENCHMARK (propagate_1048576)
+{
+    const size_t        count   {0x400 * batch};
+    const Ellipse       orbits  [0x2]
+        { Ellipse (1.f, 0.5f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f)
+        , Ellipse (1.f, 2.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 1.f, 0.f, 0.f)
+        };
+    vector <uint32_t>   orbit   (count);
+    vector <float>      mean    (count);
+    vector <float>      storage (0x3 * count);
+    Ellipse :: Bodies   bodies  {};
+
+    bodies.orbit    = orbit.data ();
+    bodies.mean     = mean.data ();
+
+    for (size_t i = 0x0; i < 0x3; i++)
+        bodies.position[i] = & storage[i * count];
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        orbit[i]    = uint32_t (i % 0x2);
+        mean[i]     = float (i) * 1e-5f;
+    };
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse :: propagate (orbits, 0x2, bodies, count, 1.f, 0.01f, 0x0);
+        keep (storage);
+    };
+}
+
+
+
+/*
+ * Inverse parametrisation.
+ */
+
+BENCHMARK (parameter_of)
+{
+    Ellipse ellipse (0.5f, 0.5f, 1.f, 2.f, 0.f, 1.f, 0.2f, 0.f, 0.f, 0.f, 1.f);
+
+    const vector <float>    point   {ellipse.eval_world (0.3f)};
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.parameter_of (point[0x0], point[0x1], point[0x2], false));
+}
+
+BENCHMARK (parameter_of_batch_1024)
+{
+    Ellipse ellipse (0.5f, 0.5f, 1.f, 2.f, 0.f, 1.f, 0.2f, 0.f, 0.f, 0.f, 1.f);
+
+    const vector <float>    angles  {parameters ()};
+    vector <float>          x       (batch);
+    vector <float>          y       (batch);
+    vector <float>          z       (batch);
+    vector <float>          t       (batch);
+
+    ellipse.eval_world (angles.data (), batch, x.data (), y.data (), z.data ());
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.parameter_of    ( x.data (), y.data (), z.data (), batch
+                                , t.data (), false
+                                );
+        keep (t);
+    };
+}
+
+BENCHMARK (parameter_of_refine_batch_1024)
+{
+    Ellipse ellipse (0.5f, 0.5f, 1.f, 2.f, 0.f, 1.f, 0.2f, 0.f, 0.f, 0.f, 1.f);
+
+    const vector <float>    angles  {parameters ()};
+    vector <float>          x       (batch);
+    vector <float>          y       (batch);
+    vector <float>          z       (batch);
+    vector <float>          t       (batch);
+
+    ellipse.eval_world (angles.data (), batch, x.data (), y.data (), z.data ());
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.parameter_of    ( x.data (), y.data (), z.data (), batch
+                                , t.data (), true
+                                );
+        keep (t);
+    };
+}
+
+
+
+/*
+ * Sampling.
+ */
+
+BENCHMARK (sample_area_1048576)
+{
+    Ellipse         ellipse
+        (0.5f, 0.5f, 0.f, 0.f, 0.f, 1.f, 0.2f, 0.f, 0.f, 0.f, 1.f);
+    const size_t    count   {0x400 * batch};
+    vector <float>  x       (count);
+    vector <float>  y       (count);
+    vector <float>  z       (count);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.sample_area (i, count, x.data (), y.data (), z.data (), 0x0);
+        keep (x);
+    };
+}
+
+BENCHMARK (sample_perimeter_1048576)
+{
+    Ellipse         ellipse
+        (0.5f, 0.5f, 0.f, 0.f, 0.f, 1.f, 0.2f, 0.f, 0.f, 0.f, 1.f);
+    const size_t    count   {0x400 * batch};
+    vector <float>  x       (count);
+    vector <float>  y       (count);
+    vector <float>  z       (count);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse.sample_perimeter    ( i, count, x.data (), y.data (), z.data ()
+                                    , 0x0
+                                    );
+        keep (x);
+    };
+}
+
+
+
+
+/*
+ * Streaming.
+ */
+
+BENCHMARK (samples_1024)
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        float   sum {0.f};
+
+        for (const Stream :: Point point : ellipse.samples (0.f, 1e-3f, batch))
+            sum += point.x + point.y + point.z;
+
+        keep (sum);
+    };
+}
+
+BENCHMARK (samples_polynomial3_1024)
+{
+    Ellipse     ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const Trig  trig    (Trig :: polynomial, 0x3);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        float   sum {0.f};
+
+        for ( const Stream :: Point point
+            : ellipse.samples (0.f, 1e-3f, batch, trig)
+            )
+            sum += point.x + point.y + point.z;
+
+        keep (sum);
+    };
+}
+
+
+
+/*
+ * C interface.
+ */
+
+BENCHMARK (c_eval_batch_1024)
+{
+    const float             centre  [0x3]   {0.f, 0.f, 0.f};
+    const float             tangent [0x3]   {1.f, 0.f, 0.f};
+    const float             normal  [0x3]   {0.f, 0.f, 1.f};
+    ellipse_t *             ellipse
+        {ellipse_create (2.f, 1.f, centre, tangent, normal)};
+    const vector <float>    t   {parameters ()};
+    vector <float>          x   (batch);
+    vector <float>          y   (batch);
+    vector <float>          z   (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse_eval    ( ellipse
+                        , {t.data (), sizeof (float)}
+                        , batch
+                        , {x.data (), sizeof (float)}
+                        , {y.data (), sizeof (float)}
+                        , {z.data (), sizeof (float)}
+                        , ELLIPSE_TRIG_LIBM
+                        , 0x0
+                        );
+        keep (x);
+    };
+
+    ellipse_destroy (ellipse);
+}
+
+BENCHMARK (c_eval_interleaved_batch_1024)
+{
+    const float             centre  [0x3]   {0.f, 0.f, 0.f};
+    const float             tangent [0x3]   {1.f, 0.f, 0.f};
+    const float             normal  [0x3]   {0.f, 0.f, 1.f};
+    ellipse_t *             ellipse
+        {ellipse_create (2.f, 1.f, centre, tangent, normal)};
+    const vector <float>    t       {parameters ()};
+    vector <float>          points  (0x3 * batch);
+    const ptrdiff_t         stride  {0x3 * sizeof (float)};
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        ellipse_eval    ( ellipse
+                        , {t.data (), sizeof (float)}
+                        , batch
+                        , {points.data (), stride}
+                        , {points.data () + 0x1, stride}
+                        , {points.data () + 0x2, stride}
+                        , ELLIPSE_TRIG_LIBM
+                        , 0x0
+                        );
+        keep (points);
+    };
+
+    ellipse_destroy (ellipse);
+}
+
+
+
+/*
+ * Scenes.
+ */
+
+BENCHMARK (scene_heap_100000)
+{
+    const size_t        count   {100000};
+    vector <Ellipse *>  scene   (count);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        for (size_t j = 0x0; j < count; j++)
+            scene[j] = new Ellipse
+                (1.f, 0.5f, float (j), 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+        keep (scene);
+
+        for (Ellipse * ellipse : scene)
+            delete ellipse;
+    };
+}
+
+BENCHMARK (scene_arena_100000)
+{
+    const size_t        count   {100000};
+    Arena               arena   (count * sizeof (Ellipse));
+    vector <Ellipse *>  scene   (count);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        for (size_t j = 0x0; j < count; j++)
+            scene[j] = arena.create <Ellipse>
+                (1.f, 0.5f, float (j), 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+        keep (scene);
+
+        arena.release ();
+    };
+}
+
+
+
+/*
+ * Sharing.
+ */
+
+BENCHMARK (shared_read_eval_curvature)
+{
+    const Shared    shared
+        (Ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f));
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        const Shared :: Reader  reader  {shared.read ()};
+
+        keep (reader -> eval_curvature (float (i) * 1e-3f));
+    };
+}
+
+BENCHMARK (mutex_read_eval_curvature)
+{
+    const Ellipse   ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    std :: mutex    mutex;
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        const std :: lock_guard <std :: mutex>  lock    (mutex);
+
+        keep (ellipse.eval_curvature (float (i) * 1e-3f));
+    };
+}
+
+BENCHMARK (shared_publish)
+{
+    Shared          shared
+        (Ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f));
+    const Ellipse   next
+        (3.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        shared.publish (next);
+}
+
+
+
+/*
+ * Caching of the derived data.
+ */
+
+static void burst   ( const Ellipse :: Caching caching
+                    , const size_t iterations
+                    )
+{
+    Ellipse ellipse (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    ellipse.set_caching (caching);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        const float f   {float (i & 0xff) * 1e-3f};
+
+        ellipse.set_centre (f, 1.f, 0.f);
+        ellipse.set_tangent (1.f, f, 0.f);
+        ellipse.set_normal (0.f, f, 1.f);
+        ellipse.set_major (2.f + f);
+        ellipse.set_minor (1.f - f);
+
+        keep (ellipse.get_perimeter ());
+        keep (ellipse.get_conic ());
+    };
+}
+
+BENCHMARK (burst_none)
+{
+    burst (Ellipse :: none, iterations);
+}
+
+BENCHMARK (burst_immediate)
+{
+    burst (Ellipse :: immediate, iterations);
+}
+
+BENCHMARK (burst_deferred)
+{
+    burst (Ellipse :: deferred, iterations);
+}
+
+BENCHMARK (get_perimeter)
+{
+    const Ellipse   ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (ellipse.get_perimeter ());
+}
+
+
+
+/*
+ * Tessellation.
+ */
+
+BENCHMARK (tessellate_scene_4096)
+{
+    const vector <Ellipse>  ellipses    {scatter (0x1000, image, image)};
+    vector <float>          x           {};
+    vector <float>          y           {};
+    vector <float>          z           {};
+
+    for (size_t i = 0x0; i < iterations; i++)
+        for (const Ellipse & ellipse : ellipses)
+            keep (ellipse.tessellate (1e-2f, x, y, z));
+}
+
+BENCHMARK (tessellate_cached_scene_4096)
+{
+    const vector <Ellipse>  ellipses    {scatter (0x1000, image, image)};
+    Tessellation            cache       (0x1000000);
+    vector <float>          x           {};
+    vector <float>          y           {};
+    vector <float>          z           {};
+
+    for (const Ellipse & ellipse : ellipses)
+        keep (ellipse.tessellate (cache, 1e-2f, x, y, z));
+
+    for (size_t i = 0x0; i < iterations; i++)
+        for (const Ellipse & ellipse : ellipses)
+            keep (ellipse.tessellate (cache, 1e-2f, x, y, z));
+}
+
+
+
+/*
+ * Enclosing ellipses.
+ */
+
+BENCHMARK (enclose_1048576)
+{
+    const Ellipse   ellipse
+        (1.f, 2.f, 1.f, -1.f, 0.f, 0.8f, 0.6f, 0.f, 0.f, 0.f, 1.f);
+    const size_t    count   {0x400 * batch};
+    vector <float>  x       (count);
+    vector <float>  y       (count);
+    vector <float>  z       (count);
+    Ellipse         result  {};
+
+    ellipse.sample_area (0x1, count, x.data (), y.data (), z.data (), 0x0);
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (Ellipse :: enclose
+                (x.data (), y.data (), count, 1e-3f, result, 0x0));
+}
+
+
+
+/*
+ * Rational Bezier segments.
+ */
+
+BENCHMARK (to_rational_bezier_batch_1024)
+{
+    const vector <Ellipse>  ellipses    {scatter (batch, image, image)};
+    vector <Bezier>         beziers     (0x4 * batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        Ellipse :: to_rational_bezier
+            (ellipses.data (), batch, 0x4, beziers.data ());
+        keep (beziers);
+    };
+}
+
+BENCHMARK (bezier_eval_batch_1024)
+{
+    const Ellipse           ellipse
+        (2.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+    const vector <Bezier>   beziers {ellipse.to_rational_bezier (0x4)};
+    const size_t            part    {batch / 0x4};
+    vector <float>          s       (part);
+    vector <float>          x       (batch);
+    vector <float>          y       (batch);
+    vector <float>          z       (batch);
+
+    for (size_t i = 0x0; i < part; i++)
+        s[i] = float (i) / float (part);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        for (size_t k = 0x0; k < 0x4; k++)
+            beziers[k].eval ( s.data ()
+                            , part
+                            , x.data () + k * part
+                            , y.data () + k * part
+                            , z.data () + k * part
+                            );
+
+        keep (x);
+    };
+}
+
+
+/*
+ * Intersections.
+ */
+
+static vector <vector <float>> rays (void)
+{
+    vector <vector <float>> ret (0x6, vector <float> (batch));
+
+    for (size_t i = 0x0; i < batch; i++)
+    {
+        const float t   {6.28318531f * float (i) / float (batch)};
+
+        ret[0x0][i] = 4.f * cos (t);
+        ret[0x1][i] = 4.f * sin (t);
+        ret[0x2][i] = 2.f;
+        ret[0x3][i] = - ret[0x0][i] * float (i % 0x3) * 0.5f;
+        ret[0x4][i] = - ret[0x1][i] * 0.5f;
+        ret[0x5][i] = -2.f;
+    };
+
+    return ret;
+}
+
+BENCHMARK (intersect_disk_batch_1024)
+{
+    const Ellipse                   ellipse
+        (1.f, 2.f, 0.f, 0.f, 0.f, 0.8f, 0.6f, 0.f, 0.f, 0.3f, 1.f);
+    const vector <vector <float>>   data        {rays ()};
+    const Ellipse :: Rays           batch_rays
+        { {data[0x0].data (), data[0x1].data (), data[0x2].data ()}
+        , {data[0x3].data (), data[0x4].data (), data[0x5].data ()}
+        };
+    vector <float>                  distance    (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        keep (ellipse.intersect_disk (batch_rays, batch, distance.data ()));
+        keep (distance);
+    };
+}
+
+BENCHMARK (intersect_line_batch_1024)
+{
+    const Ellipse                   ellipse
+        (1.f, 2.f, 0.f, 0.f, 0.f, 0.8f, 0.6f, 0.f, 0.f, 0.f, 1.f);
+    vector <vector <float>>         data        {rays ()};
+
+    for (size_t i = 0x0; i < batch; i++)
+    {
+        data[0x2][i] = 0.f;
+        data[0x5][i] = 0.f;
+    };
+
+    const Ellipse :: Rays           lines
+        { {data[0x0].data (), data[0x1].data (), data[0x2].data ()}
+        , {data[0x3].data (), data[0x4].data (), data[0x5].data ()}
+        };
+    vector <float>                  first       (batch);
+    vector <float>                  second      (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        keep (ellipse.intersect_line
+                (lines, batch, first.data (), second.data ()));
+        keep (first);
+        keep (second);
+    };
+}
+
+BENCHMARK (intersect_plane_batch_1024)
+{
+    const Ellipse                   ellipse
+        (1.f, 2.f, 0.f, 0.f, 0.f, 0.8f, 0.6f, 0.f, 0.f, 0.3f, 1.f);
+    const vector <vector <float>>   data        {rays ()};
+    const vector <float>            offset      (batch, 0.5f);
+    const Ellipse :: Planes         planes
+        { {data[0x0].data (), data[0x1].data (), data[0x5].data ()}
+        , offset.data ()
+        };
+    vector <float>                  first       (batch);
+    vector <float>                  second      (batch);
+
+    for (size_t i = 0x0; i < iterations; i++)
+    {
+        keep (ellipse.intersect_plane
+                (planes, batch, first.data (), second.data ()));
+        keep (first);
+        keep (second);
+    };
+}
+
+
+/*
+ * Intersection over union.
+ */
+
+BENCHMARK (iou_batch_1024)
+{
+    const vector <Ellipse>  ellipses    {scatter (batch, 0x40, 0x40)};
+
+    for (size_t i = 0x0; i < iterations; i++)
+        for (size_t k = 0x0; k < batch; k++)
+            keep (ellipses[k].iou (ellipses[(k + 0x1) % batch]));
+}
+
+BENCHMARK (suppress_100000)
+{
+    const size_t        count       {0x186a0};
+    vector <Ellipse>    candidates  {};
+    vector <float>      scores      (count);
+    vector <size_t>     kept        (count);
+
+    candidates.reserve (count);
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        uint32_t    object  [0x4];
+        uint32_t    random  [0x4];
+
+        Philox :: generate (i / 0xa, 0x1, object);
+        Philox :: generate (i, 0x2, random);
+
+        const float angle   {3.14159265f * Philox :: uniform (object[0x2])};
+        const float jitter  {2.f * Philox :: uniform (random[0x0]) - 1.f};
+
+        candidates.emplace_back ( float (object[0x3] % 0x10) + 2.f
+                                , float (object[0x3] % 0x7)
+                                , 3840.f * Philox :: uniform (object[0x0])
+                                  + jitter
+                                , 2160.f * Philox :: uniform (object[0x1])
+                                  - 0.5f * jitter
+                                , 0.f
+                                , cos (angle)
+                                , sin (angle)
+                                , 0.f
+                                , 0.f
+                                , 0.f
+                                , 1.f
+                                );
+        scores[i] = Philox :: uniform (random[0x1]);
+    };
+
+    for (size_t i = 0x0; i < iterations; i++)
+        keep (Ellipse :: suppress ( candidates.data ()
+                                  , scores.data ()
+                                  , count
+                                  , 0.5f
+                                  , kept.data ()
+                                  , 0x0
+                                  ));
+}
+
+/******************************************************************************/
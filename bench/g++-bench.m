@@ -0,0 +1,144 @@
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%%
+%% Copyright (C) 2022 Kevin Matthes
+%%
+%% This program is free software; you can redistribute it and/or modify
+%% it under the terms of the GNU General Public License as published by
+%% the Free Software Foundation; either version 2 of the License, or
+%% (at your option) any later version.
+%%
+%% This program is distributed in the hope that it will be useful,
+%% but WITHOUT ANY WARRANTY; without even the implied warranty of
+%% MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+%% GNU General Public License for more details.
+%%
+%% You should have received a copy of the GNU General Public License along
+%% with this program; if not, write to the Free Software Foundation, Inc.,
+%% 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+%%
+%%%%
+%%
+%%  FILE
+%%      g++-bench.m
+%%
+%%  BRIEF
+%%      Compile the benchmark executable using `g++`.
+%%
+%%  AUTHOR
+%%      Kevin Matthes
+%%
+%%  COPYRIGHT
+%%      (C) 2022 Kevin Matthes.
+%%      This file is licensed GPL 2 as of June 1991.
+%%
+%%  DATE
+%%      2022
+%%
+%%  NOTE
+%%      See `LICENSE' for full license.
+%%      See `README.md' for project details.
+%%
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+%%%%
+%%
+%% Variables.
+%%
+%%%%
+
+% Software.
+software.compiler.self  = ' g++ ';
+software.compiler.flags = ' -Wall -Werror -Wextra -Wpedantic -std=c++11 ';
+software.compiler.flags = [software.compiler.flags ' -O2 -fopenmp-simd '];
+software.compiler.flags = [software.compiler.flags ' -fno-math-errno '];
+software.compiler.flags = [software.compiler.flags ' -fno-trapping-math '];
+software.compiler.call  = [software.compiler.self software.compiler.flags];
+
+software.linker.flags   = ' -pthread ';
+
+
+
+% Files.
+files.self      = ' g++-bench.m ';
+files.source    = ' *.cpp ';
+
+files.archive.library   = ' ../lib/libellipse.a ';
+files.archive.target    = ' ellipse-bench ';
+
+files.header.flags      = ' -D__ELLIPSE_HEADER_ONLY__ ';
+files.header.target     = ' ellipse-bench-header-only ';
+
+files.lto.flags         = ' -flto ';
+files.lto.library       = ' ../lib/libellipse-lto.a ';
+files.lto.target        = ' ellipse-bench-lto ';
+
+
+
+% Control flow.
+banner  = ['[' files.self '] '];
+
+
+
+% Call adjustment.
+software.compiler.call  = [software.compiler.call files.source];
+
+call.archive    = [software.compiler.call ' -o ' files.archive.target];
+call.archive    = [call.archive files.archive.library];
+call.archive    = [call.archive software.linker.flags];
+
+call.header     = [software.compiler.call files.header.flags];
+call.header     = [call.header ' -o ' files.header.target];
+call.header     = [call.header software.linker.flags];
+
+call.lto        = [software.compiler.call files.lto.flags];
+call.lto        = [call.lto ' -o ' files.lto.target];
+call.lto        = [call.lto files.lto.library];
+call.lto        = [call.lto software.linker.flags];
+
+
+
+%%%%
+%%
+%% Build steps.
+%%
+%%%%
+
+% Begin build instruction.
+disp ([banner 'Begin build instruction.']);
+
+
+
+% Call C++ compiler.
+disp ([banner 'Compile benchmark executable using the static library ...']);
+
+disp (call.archive);
+system (call.archive);
+
+disp ([banner 'Done.']);
+
+
+
+% Call C++ compiler in header-only mode.
+disp ([banner 'Compile benchmark executable in header-only mode ...']);
+
+disp (call.header);
+system (call.header);
+
+disp ([banner 'Done.']);
+
+
+
+% Call C++ compiler with Link Time Optimisation.
+disp ([banner 'Compile benchmark executable using the LTO library ...']);
+
+disp (call.lto);
+system (call.lto);
+
+disp ([banner 'Done.']);
+
+
+
+% End build instruction.
+disp ([banner 'End build instruction.']);
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The implementation of the benchmark harness.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        harness.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Benchmark` class as well as the
+ * replacements of the global allocation functions which are required in order
+ * to count the allocations per operation.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+using std :: atomic;
+using std :: chrono :: duration;
+using std :: chrono :: steady_clock;
+using std :: sort;
+
+
+
+/*
+ * Allocation tracking.
+ */
+
+static atomic <size_t>  allocation_count    {0x0};
+static atomic <size_t>  allocation_bytes    {0x0};
+
+void * operator new (size_t size)
+{
+    allocation_count.fetch_add (0x1, std :: memory_order_relaxed);
+    allocation_bytes.fetch_add (size, std :: memory_order_relaxed);
+
+    void * ret = std :: malloc (size ? size : 0x1);
+
+    if (! ret)
+        throw std :: bad_alloc ();
+
+    return ret;
+}
+
+void * operator new [] (size_t size)
+{
+    return operator new (size);
+}
+
+void operator delete (void * pointer) noexcept
+{
+    std :: free (pointer);
+}
+
+void operator delete [] (void * pointer) noexcept
+{
+    std :: free (pointer);
+}
+
+void operator delete (void * pointer, size_t) noexcept
+{
+    std :: free (pointer);
+}
+
+void operator delete [] (void * pointer, size_t) noexcept
+{
+    std :: free (pointer);
+}
+
+
+
+/**
+ * \brief   Register a new benchmark.
+ * \param   name    The benchmark's name.
+ * \param   body    The function performing the benchmarked operation.
+ *
+ * Benchmarks are usually created as static objects by the `BENCHMARK` macro.
+ * Thus, they register themselves before `main` is entered.
+ */
+
+Benchmark :: Benchmark (const char * name, Body body)
+    : name (name)
+    , body (body)
+{
+    Benchmark :: registry ().push_back (this);
+    return;
+}
+
+
+
+/**
+ * \brief   The count of allocations since the start of the programme.
+ * \return  The current count of calls to `operator new`.
+ */
+
+size_t Benchmark :: allocations (void)
+{
+    return allocation_count.load (std :: memory_order_relaxed);
+}
+
+
+
+/**
+ * \brief   The count of allocated bytes since the start of the programme.
+ * \return  The current sum of the sizes passed to `operator new`.
+ */
+
+size_t Benchmark :: allocated (void)
+{
+    return allocation_bytes.load (std :: memory_order_relaxed);
+}
+
+
+
+/**
+ * \brief   The list of all registered benchmarks.
+ * \return  A reference to the list.
+ *
+ * The list is created on first use in order to avoid depending on the
+ * initialisation order of static objects in different translation units.
+ */
+
+vector <Benchmark *> & Benchmark :: registry (void)
+{
+    static vector <Benchmark *> ret {};
+    return ret;
+}
+
+
+
+/**
+ * \brief   Measure this benchmark.
+ * \param   min_time    The minimal duration of a single sample in seconds.
+ * \param   perf        The hardware performance counters, if any.
+ * \return  The normalised measurement.
+ *
+ * At first, the count of iterations is increased until a single call of the
+ * body takes at least `min_time` seconds.  Then, five samples are taken with
+ * this count and the median of their timings is reported in order to reduce
+ * the influence of outliers.
+ *
+ * In case hardware performance counters are passed, they are read around the
+ * samples.  Unavailable counters are reported as NaN.
+ *
+ * The allocations are counted in two separate calls of the body with one and
+ * two iterations, respectively.  Their difference is the count per iteration
+ * while the remainder is the count per call of the body, for instance for the
+ * setup of buffers.  Thus, neither depends on the count of iterations chosen
+ * for the samples.
+ */
+
+Benchmark :: Result Benchmark :: run (const double min_time, Perf * perf)
+{
+    Result          ret     {};
+    size_t          count   {0x1};
+    vector <double> samples {};
+
+    for (;;)
+    {
+        const auto      begin   {steady_clock :: now ()};
+        this -> body (count);
+        const double    elapsed
+            {duration <double> (steady_clock :: now () - begin).count ()};
+
+        if (elapsed >= min_time || count >= (size_t (0x1) << 0x28))
+            break;
+
+        const double factor {elapsed > 0. ? 1.4 * min_time / elapsed : 10.};
+        count = size_t (double (count) * std :: min (factor, 10.)) + 0x1;
+    };
+
+    samples.reserve (0x5);
+
+    uint64_t    counters    [Perf :: events] {};
+
+    if (perf)
+        perf -> start ();
+
+    for (size_t i = 0x0; i < 0x5; i++)
+    {
+        const auto  begin   {steady_clock :: now ()};
+        this -> body (count);
+        samples.push_back
+            (duration <double> (steady_clock :: now () - begin).count ());
+    };
+
+    if (perf)
+        perf -> stop (counters);
+
+    double  allocations [0x2]   {};
+    double  bytes       [0x2]   {};
+
+    for (size_t i = 0x0; i < 0x2; i++)
+    {
+        const size_t    allocations_before  {Benchmark :: allocations ()};
+        const size_t    bytes_before        {Benchmark :: allocated ()};
+
+        this -> body (i + 0x1);
+
+        allocations[i]  = double (Benchmark :: allocations ()
+                                  - allocations_before);
+        bytes[i]        = double (Benchmark :: allocated () - bytes_before);
+    };
+
+    const double    total   {double (count) * double (samples.size ())};
+
+    sort (samples.begin (), samples.end ());
+
+    ret.name            = this -> name;
+    ret.iterations      = count;
+    ret.ns_per_op       = samples[samples.size () / 0x2] * 1e9 / count;
+    ret.allocs_per_op   = allocations[0x1] - allocations[0x0];
+    ret.allocs_per_call = allocations[0x0] - ret.allocs_per_op;
+    ret.bytes_per_op    = bytes[0x1] - bytes[0x0];
+    ret.bytes_per_call  = bytes[0x0] - ret.bytes_per_op;
+
+    for (int i = 0x0; i < Perf :: events; i++)
+        ret.counters[i] = perf && perf -> available (Perf :: Event (i))
+                        ? counters[i] / total
+                        : NAN;
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the benchmark harness.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        harness.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces a small, self-contained benchmark harness for the
+ * library.  Each benchmark is a function which performs the measured operation
+ * a given number of times.  It is registered by the `BENCHMARK` macro such that
+ * the main programme can find, run and report it.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __HARNESS_HPP__
+#define __HARNESS_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "perf.hpp"
+
+using std :: size_t;
+using std :: string;
+using std :: vector;
+
+
+
+/**
+ * \brief   A registered benchmark.
+ *
+ * Every benchmark consists of a name and a body.  The body is called with the
+ * number of iterations to perform and shall execute the measured operation
+ * exactly that often.  Setup work should happen before the loop such that it
+ * does not distort the result too much.
+ */
+
+class Benchmark
+{
+    public:
+        typedef void (* Body) (const size_t iterations);
+
+        /**
+         * \brief   The result of a single benchmark run.
+         *
+         * The numbers are normalised to a single iteration of the benchmark's
+         * body.  The allocations per call of the body, such as for its setup,
+         * are reported separately.
+         */
+
+        struct Result
+        {
+            string  name;
+            size_t  iterations;
+            double  ns_per_op;
+            double  allocs_per_op;
+            double  allocs_per_call;
+            double  bytes_per_op;
+            double  bytes_per_call;
+            double  counters    [Perf :: events];
+        };
+
+        const char *    name;
+        Body            body;
+
+        Benchmark (const char * name, Body body);
+
+        Result  run (const double min_time, Perf * perf);
+
+        static vector <Benchmark *> &   registry    (void);
+        static size_t                   allocations (void);
+        static size_t                   allocated   (void);
+};
+
+
+
+/**
+ * \brief   Prevent the compiler from optimising away a computed value.
+ * \param   value   The value to keep alive.
+ *
+ * The benchmarked operations are usually cheap and free of side effects.  In
+ * order to measure them nevertheless, their results are passed to this
+ * function which pretends to read them.
+ */
+
+template <typename T> inline void keep (T const & value)
+{
+    asm volatile ("" : : "g" (& value) : "memory");
+}
+
+
+
+/**
+ * \brief   Define and register a new benchmark.
+ *
+ * The macro declares the body of the benchmark, registers it and opens the
+ * body's definition.  The body receives the count of iterations as
+ * `iterations`.
+ */
+
+#define BENCHMARK(name)                                                     \
+    static void bench_##name (const size_t iterations);                     \
+    static Benchmark bench_##name##_registration (#name, bench_##name);     \
+    static void bench_##name (const size_t iterations)
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __HARNESS_HPP__
+
+/******************************************************************************/
@@ -0,0 +1,332 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The main programme of the benchmarks.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        main.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the entry point of the benchmark executable.  It
+ * runs all registered benchmarks, reports them and compares them against a
+ * stored baseline, if requested.
+ *
+ * The following options are supported.
+ *
+ *  - `--filter <text>`:        Run only benchmarks whose name contains `text`.
+ *  - `--min-time <seconds>`:   The minimal duration of a sample.
+ *  - `--json <file>`:          Write the results as JSON to `file`.
+ *  - `--baseline <file>`:      Compare the results against a former JSON file.
+ *  - `--tolerance <ratio>`:    The allowed relative slowdown, `0.1` by default.
+ *  - `--perf`:                 Read hardware performance counters, as well.
+ *  - `--perf-vector <event>`:  The raw event counting vector instructions.
+ *
+ * In case a regression is detected or the baseline cannot be read, the
+ * programme exits with a non-zero status such that it can be used as a release
+ * check.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "harness.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+
+using std :: ifstream;
+using std :: map;
+using std :: unique_ptr;
+
+
+
+/**
+ * \brief   The values of a benchmark as stored in a baseline.
+ */
+
+struct Baseline
+{
+    double  ns_per_op;
+    double  allocs_per_op;
+    double  allocs_per_call;
+};
+
+
+
+/**
+ * \brief   Read a baseline file.
+ * \param   path        The path to the JSON file written by a former run.
+ * \param   baseline    The stored results by benchmark name.
+ * \return  Whether the file could be opened and contained any benchmark.
+ *
+ * The JSON files written by this programme contain exactly one benchmark per
+ * line.  Hence, no general JSON parser is required in order to read them.
+ * Baselines written before the allocations per call were recorded lack them;
+ * they are set to NaN, then, and not compared.
+ */
+
+static bool read_baseline   ( const char * path
+                            , map <string, Baseline> & baseline
+                            )
+{
+    ifstream    file    {path};
+    string      line    {};
+
+    if (! file.is_open ())
+        return false;
+
+    while (std :: getline (file, line))
+    {
+        const char *    name    {std :: strstr (line.c_str (), "\"name\": \"")};
+        const char *    ns      {std :: strstr (line.c_str (), "\"ns_per_op\": ")};
+        const char *    allocs
+            {std :: strstr (line.c_str (), "\"allocs_per_op\": ")};
+        const char *    calls
+            {std :: strstr (line.c_str (), "\"allocs_per_call\": ")};
+
+        if (! name || ! ns || ! allocs)
+            continue;
+
+        name += std :: strlen ("\"name\": \"");
+
+        const char *    end {std :: strchr (name, '"')};
+
+        if (! end)
+            continue;
+
+        Baseline    value   {};
+
+        value.ns_per_op     = std :: atof (ns + std :: strlen ("\"ns_per_op\": "));
+        value.allocs_per_op
+            = std :: atof (allocs + std :: strlen ("\"allocs_per_op\": "));
+        value.allocs_per_call
+            = calls
+            ? std :: atof (calls + std :: strlen ("\"allocs_per_call\": "))
+            : NAN;
+
+        baseline[string (name, end)] = value;
+    };
+
+    return ! baseline.empty ();
+}
+
+
+
+/**
+ * \brief   Write the results as JSON.
+ * \param   path    The file to write to.
+ * \param   results The results to write.
+ * \param   perf    Whether hardware performance counters were read.
+ * \return  Whether the file could be written.
+ *
+ * Unavailable hardware performance counters are written as `null`.
+ */
+
+static bool write_json  ( const char * path
+                        , const vector <Benchmark :: Result> & results
+                        , const bool perf
+                        )
+{
+    FILE * file {std :: fopen (path, "w")};
+
+    if (! file)
+        return false;
+
+    std :: fprintf (file, "{\n    \"benchmarks\": [\n");
+
+    for (size_t i = 0x0; i < results.size (); i++)
+    {
+        std :: fprintf  ( file
+                        , "        {\"name\": \"%s\", \"iterations\": %zu, "
+                          "\"ns_per_op\": %.3f, \"allocs_per_op\": %.3f, "
+                          "\"allocs_per_call\": %.3f, \"bytes_per_op\": %.3f, "
+                          "\"bytes_per_call\": %.3f"
+                        , results[i].name.c_str ()
+                        , results[i].iterations
+                        , results[i].ns_per_op
+                        , results[i].allocs_per_op
+                        , results[i].allocs_per_call
+                        , results[i].bytes_per_op
+                        , results[i].bytes_per_call
+                        );
+
+        for (int j = 0x0; perf && j < Perf :: events; j++)
+            if (std :: isnan (results[i].counters[j]))
+                std :: fprintf (file, ", \"%s_per_op\": null", Perf :: names[j]);
+            else
+                std :: fprintf  ( file, ", \"%s_per_op\": %.3f"
+                                , Perf :: names[j], results[i].counters[j]
+                                );
+
+        std :: fprintf (file, "}%s\n", i + 0x1 < results.size () ? "," : "");
+    };
+
+    std :: fprintf (file, "    ]\n}\n");
+
+    return ! std :: fclose (file);
+}
+
+
+
+/**
+ * \brief   The entry point of the benchmarks.
+ * \param   argc    The count of command line arguments.
+ * \param   argv    The command line arguments.
+ * \return  Zero, if no regression was detected, otherwise one.  Invalid options
+ *          and unreadable files result in two.
+ */
+
+int main (int argc, char ** argv)
+{
+    const char *    baseline        {nullptr};
+    const char *    filter          {""};
+    const char *    json            {nullptr};
+    double          min_time        {0.05};
+    bool            perf            {false};
+    double          tolerance       {0.1};
+    uint64_t        vector_event    {0x0};
+
+    for (int i = 0x1; i < argc; i++)
+    {
+        const bool  next    {i + 0x1 < argc};
+
+        if (! std :: strcmp (argv[i], "--baseline") && next)
+            baseline = argv[++i];
+        else if (! std :: strcmp (argv[i], "--filter") && next)
+            filter = argv[++i];
+        else if (! std :: strcmp (argv[i], "--json") && next)
+            json = argv[++i];
+        else if (! std :: strcmp (argv[i], "--min-time") && next)
+            min_time = std :: atof (argv[++i]);
+        else if (! std :: strcmp (argv[i], "--perf"))
+            perf = true;
+        else if (! std :: strcmp (argv[i], "--perf-vector") && next)
+            vector_event = std :: strtoull (argv[++i], nullptr, 0x0);
+        else if (! std :: strcmp (argv[i], "--tolerance") && next)
+            tolerance = std :: atof (argv[++i]);
+        else
+        {
+            std :: fprintf (stderr, "Unknown option: %s\n", argv[i]);
+            return 0x2;
+        };
+    };
+
+    map <string, Baseline>          reference   {};
+    vector <Benchmark :: Result>    results     {};
+    int                             ret         {0x0};
+    unique_ptr <Perf>               counters    {};
+
+    if (baseline && ! read_baseline (baseline, reference))
+    {
+        std :: fprintf (stderr, "Could not read baseline %s\n", baseline);
+        return 0x2;
+    };
+
+    if (perf)
+    {
+        counters.reset (new Perf (vector_event));
+        std :: fprintf (stderr, "%s", counters -> status ().c_str ());
+    };
+
+    std :: printf   ( "%-40s %14s %12s %10s %12s %10s"
+                    , "benchmark", "iterations", "ns/op", "allocs/op"
+                    , "allocs/call", "baseline"
+                    );
+
+    if (perf)
+        std :: printf   ( " %8s %12s %12s %12s"
+                        , "IPC", "cache-miss/op", "branch-miss/op", "vector/op"
+                        );
+
+    std :: printf ("\n");
+
+    for (Benchmark * benchmark : Benchmark :: registry ())
+    {
+        if (! std :: strstr (benchmark -> name, filter))
+            continue;
+
+        const Benchmark :: Result   result
+            {benchmark -> run (min_time, counters.get ())};
+        string                      verdict {"-"};
+
+        if (reference.count (result.name))
+        {
+            const Baseline &    base    {reference[result.name]};
+            char                buffer  [0x20];
+
+            std :: snprintf ( buffer, sizeof (buffer), "%+.1f%%"
+                            , 100. * (result.ns_per_op / base.ns_per_op - 1.)
+                            );
+
+            verdict = buffer;
+
+            if  (  result.ns_per_op > base.ns_per_op * (1. + tolerance)
+                || result.allocs_per_op > base.allocs_per_op + 0.5
+                || result.allocs_per_call > base.allocs_per_call + 0.5
+                )
+            {
+                verdict += " REGRESSION";
+                ret     = 0x1;
+            };
+        };
+
+        std :: printf   ( "%-40s %14zu %12.2f %10.0f %12.0f %10s"
+                        , result.name.c_str ()
+                        , result.iterations
+                        , result.ns_per_op
+                        , result.allocs_per_op
+                        , result.allocs_per_call
+                        , verdict.c_str ()
+                        );
+
+        if (perf)
+            std :: printf   ( " %8.2f %12.3f %12.3f %12.3f"
+                            , result.counters[Perf :: instructions]
+                                / result.counters[Perf :: cycles]
+                            , result.counters[Perf :: cache_misses]
+                            , result.counters[Perf :: branch_misses]
+                            , result.counters[Perf :: vector]
+                            );
+
+        std :: printf ("\n");
+
+        results.push_back (result);
+    };
+
+    if (json && ! write_json (json, results, perf))
+    {
+        std :: fprintf (stderr, "Could not write %s\n", json);
+        ret = 0x2;
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
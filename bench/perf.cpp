@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The hardware performance counters of the benchmarks.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        perf.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Perf` class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "perf.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef  __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // ! __linux__
+
+
+
+/**
+ * \brief   The names of the counters as used in the reports.
+ */
+
+const char * const Perf :: names [Perf :: events] =
+    { "cycles"
+    , "instructions"
+    , "cache_misses"
+    , "branch_misses"
+    , "vector"
+    };
+
+
+
+/**
+ * \brief   Open the counters.
+ * \param   vector_event    The raw event counting vector instructions, or 0.
+ *
+ * Counters which cannot be opened are marked as unavailable together with the
+ * reason of the failure.
+ */
+
+Perf :: Perf (const uint64_t vector_event)
+{
+    for (int i = 0x0; i < Perf :: events; i++)
+    {
+        this -> descriptors[i]  = -0x1;
+        this -> enabled[i]      = 0x0;
+        this -> error[i]        = ENOSYS;
+        this -> running[i]      = 0x0;
+    };
+
+#ifdef  __linux__
+    const uint64_t  configs [Perf :: events] =
+        { PERF_COUNT_HW_CPU_CYCLES
+        , PERF_COUNT_HW_INSTRUCTIONS
+        , PERF_COUNT_HW_CACHE_MISSES
+        , PERF_COUNT_HW_BRANCH_MISSES
+        , vector_event
+        };
+
+    for (int i = 0x0; i < Perf :: events; i++)
+    {
+        if (i == Perf :: vector && ! vector_event)
+        {
+            this -> error[i] = 0x0;
+            continue;
+        };
+
+        perf_event_attr attributes;
+
+        std :: memset (& attributes, 0x0, sizeof (attributes));
+
+        attributes.size             = sizeof (attributes);
+        attributes.type             = i == Perf :: vector ? PERF_TYPE_RAW
+                                                          : PERF_TYPE_HARDWARE;
+        attributes.config           = configs[i];
+        attributes.disabled         = 0x1;
+        attributes.exclude_kernel   = 0x1;
+        attributes.exclude_hv       = 0x1;
+        attributes.inherit          = 0x1;
+        attributes.read_format      = PERF_FORMAT_TOTAL_TIME_ENABLED
+                                    | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        this -> descriptors[i]
+            = int (syscall (SYS_perf_event_open, & attributes, 0, -1, -1, 0));
+        this -> error[i] = this -> descriptors[i] < 0x0 ? errno : 0x0;
+    };
+#else
+    (void) vector_event;
+#endif  // ! __linux__
+
+    return;
+}
+
+
+
+/**
+ * \brief   Close the counters.
+ */
+
+Perf :: ~Perf (void)
+{
+#ifdef  __linux__
+    for (int i = 0x0; i < Perf :: events; i++)
+        if (this -> descriptors[i] >= 0x0)
+            close (this -> descriptors[i]);
+#endif  // ! __linux__
+
+    return;
+}
+
+
+
+/**
+ * \brief   Whether a certain counter could be opened.
+ * \param   event   The counter to check.
+ * \return  `true`, if the counter delivers values.
+ */
+
+bool Perf :: available (const Event event) const
+{
+    return this -> descriptors[event] >= 0x0;
+}
+
+
+
+/**
+ * \brief   Reset and start all available counters.
+ *
+ * Resetting a counter does not reset its enabled and running times.  Hence,
+ * they are recorded here such that `stop` can determine the times of this
+ * measurement.
+ */
+
+void Perf :: start (void)
+{
+#ifdef  __linux__
+    for (int i = 0x0; i < Perf :: events; i++)
+        if (this -> descriptors[i] >= 0x0)
+        {
+            uint64_t    value   [0x3]   {};
+
+            ioctl (this -> descriptors[i], PERF_EVENT_IOC_RESET, 0);
+
+            if  ( read (this -> descriptors[i], value, sizeof (value))
+                == sizeof (value)
+                )
+            {
+                this -> enabled[i]  = value[0x1];
+                this -> running[i]  = value[0x2];
+            };
+
+            ioctl (this -> descriptors[i], PERF_EVENT_IOC_ENABLE, 0);
+        };
+#endif  // ! __linux__
+
+    return;
+}
+
+
+
+/**
+ * \brief   A human readable description of the counters' availability.
+ * \return  One line per counter.
+ */
+
+string Perf :: status (void) const
+{
+    string  ret {};
+
+    for (int i = 0x0; i < Perf :: events; i++)
+    {
+        ret += Perf :: names[i];
+        ret += ": ";
+        ret += this -> descriptors[i] >= 0x0    ? "available"
+             : ! this -> error[i]                ? "not configured"
+             : std :: strerror (this -> error[i]);
+        ret += "\n";
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Stop all counters and read them.
+ * \param   values  The counted events, zero for unavailable counters.
+ *
+ * Each value is followed by the times the counter was enabled and running in
+ * total.  In case the counter was multiplexed, i.e. it ran for a shorter time
+ * than it was enabled, the count is extrapolated to the whole measurement.  A
+ * counter which did not run at all reports zero.
+ */
+
+void Perf :: stop (uint64_t (& values) [Perf :: events])
+{
+    for (int i = 0x0; i < Perf :: events; i++)
+    {
+        values[i] = 0x0;
+
+#ifdef  __linux__
+        if (this -> descriptors[i] < 0x0)
+            continue;
+
+        uint64_t    value   [0x3]   {};
+
+        ioctl (this -> descriptors[i], PERF_EVENT_IOC_DISABLE, 0);
+
+        if  ( read (this -> descriptors[i], value, sizeof (value))
+            != sizeof (value)
+            )
+            continue;
+
+        const uint64_t  enabled {value[0x1] - this -> enabled[i]};
+        const uint64_t  running {value[0x2] - this -> running[i]};
+
+        if (! running)
+            continue;
+
+        values[i] = running < enabled
+                  ? uint64_t (double (value[0x0]) * double (enabled)
+                             / double (running)
+                             )
+                  : value[0x0];
+#endif  // ! __linux__
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Perf` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        perf.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the hardware performance counters of the benchmark
+ * harness.  They are read using `perf_event_open` on Linux.  On other systems
+ * or in case the kernel denies the access, the counters are just reported as
+ * unavailable.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __PERF_HPP__
+#define __PERF_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <cstdint>
+#include <string>
+
+using std :: string;
+using std :: uint64_t;
+
+
+
+/**
+ * \brief   A set of hardware performance counters.
+ *
+ * The counters are opened for the calling thread, excluding the kernel.  They
+ * are inherited by the threads created afterwards such that the work of the
+ * worker threads of batch kernels is counted, too.  Each counter is opened
+ * separately such that the unavailability of a single one does not affect the
+ * others.
+ *
+ * In case more counters are opened than the processor provides, the kernel
+ * multiplexes them.  The counts are then extrapolated by the ratio of the time
+ * the counter was enabled to the time it was actually running.
+ *
+ * There is no generic event for the utilisation of the vector units.  Thus,
+ * this counter is only opened in case a raw, CPU specific event is configured,
+ * for instance `FP_ARITH_INST_RETIRED.128B_PACKED_SINGLE` on recent Intel
+ * processors.
+ */
+
+class Perf
+{
+    public:
+        /**
+         * \brief   The supported counters.
+         */
+
+        enum Event
+        {
+            cycles,
+            instructions,
+            cache_misses,
+            branch_misses,
+            vector,
+            events
+        };
+
+        static const char * const   names   [events];
+
+        Perf    (const uint64_t vector_event);
+        ~Perf   (void);
+
+        bool    available   (const Event event) const;
+        void    start       (void);
+        void    stop        (uint64_t (& values) [events]);
+        string  status      (void) const;
+
+    private:
+        int         descriptors [events];
+        uint64_t    enabled     [events];
+        int         error       [events];
+        uint64_t    running     [events];
+
+        Perf                (const Perf &);
+        Perf &  operator =  (const Perf &);
+};
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __PERF_HPP__
+
+/******************************************************************************/
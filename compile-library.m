@@ -57,10 +57,14 @@ directories.lib = './lib/';
 
 
 % Files.
+files.ltlib = 'ar-create-lto.m';
+files.ltobj = 'g++-objects-lto.m';
 files.mklib = 'ar-create.m';
 files.mkobj = 'g++-objects.m';
 files.rmlib = 'clean-libraries.m';
 files.rmobj = 'clean-objects.m';
+files.soobj = 'g++-objects-shared.m';
+files.solib = 'g++-shared.m';
 files.self  = 'compile-library.m';
 
 
@@ -93,6 +97,12 @@ system ([octave.self ' ' files.rmlib]);
 system ([octave.self ' ' files.mkobj]);
 system ([octave.self ' ' files.mklib]);
 system ([octave.self ' ' files.rmobj]);
+system ([octave.self ' ' files.ltobj]);
+system ([octave.self ' ' files.ltlib]);
+system ([octave.self ' ' files.rmobj]);
+system ([octave.self ' ' files.soobj]);
+system ([octave.self ' ' files.solib]);
+system ([octave.self ' ' files.rmobj]);
 
 
 
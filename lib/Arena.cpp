@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The monotonic memory resource of the library.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Arena.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Arena` class which are not
+ * required to be inlined.  Since the class is an auxiliary one, all of these
+ * methods are stored in this file.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Arena.hpp"
+#include "Instrumentation.hpp"
+
+
+
+/**
+ * \brief   Create an arena with a certain initial capacity.
+ * \param   capacity    The count of bytes of the first chunk.
+ *
+ * The first chunk is allocated at once.  A capacity of zero defers the first
+ * allocation to the first request.
+ */
+
+ELLIPSE_INLINE Arena :: Arena (const size_t capacity)
+    : chunks    (nullptr)
+    , cursor    (0x0)
+    , limit     (0x0)
+{
+    if (capacity)
+    {
+        this -> grow (capacity, 0x1);
+        this -> release ();
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Return all chunks to the global heap.
+ *
+ * The destructors of the created objects are not called.
+ */
+
+ELLIPSE_INLINE Arena :: ~Arena (void)
+{
+    while (this -> chunks)
+    {
+        Chunk * const   next    {this -> chunks -> next};
+
+        :: operator delete (this -> chunks);
+
+        this -> chunks = next;
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   The count of bytes this arena can hand out without growing.
+ * \return  The size of the current chunk.
+ */
+
+ELLIPSE_INLINE size_t Arena :: capacity (void) const
+{
+    return this -> chunks ? this -> chunks -> size : 0x0;
+}
+
+
+
+/**
+ * \brief   Release all objects created within this arena at once.
+ *
+ * The destructors of the objects are not called.  The newest chunk, which is
+ * the largest one, is kept for further objects such that an arena which is
+ * filled and released repeatedly settles on a single chunk.  All other chunks
+ * are returned to the global heap.  Hence, the effort does not depend on the
+ * count of objects.
+ */
+
+ELLIPSE_INLINE void Arena :: release (void)
+{
+    if (! this -> chunks)
+        return;
+
+    Chunk * chunk   {this -> chunks -> next};
+
+    while (chunk)
+    {
+        Chunk * const   next    {chunk -> next};
+
+        :: operator delete (chunk);
+
+        chunk = next;
+    };
+
+    this -> chunks -> next  = nullptr;
+    this -> cursor
+        = reinterpret_cast <uintptr_t> (this -> chunks + 0x1);
+
+    return;
+}
+
+
+
+/**
+ * \brief   Allocate memory from a new chunk.
+ * \param   bytes       The count of bytes.
+ * \param   alignment   The alignment, a power of two.
+ * \return  The allocated memory.
+ *
+ * The new chunk is twice as large as the current one, at least large enough
+ * for the request including its alignment.  The remainder of the current chunk
+ * is abandoned.
+ */
+
+ELLIPSE_INLINE void * Arena :: grow (const size_t bytes, const size_t alignment)
+{
+    const size_t    doubled {0x2 * this -> capacity ()};
+    const size_t    needed  {bytes + alignment - 0x1};
+    const size_t    size    {doubled > needed ? doubled : needed};
+
+    ELLIPSE_ALLOCATE (sizeof (Chunk) + size);
+
+    Chunk * const   chunk
+        {static_cast <Chunk *> (:: operator new (sizeof (Chunk) + size))};
+
+    chunk -> next   = this -> chunks;
+    chunk -> size   = size;
+
+    this -> chunks  = chunk;
+    this -> cursor  = reinterpret_cast <uintptr_t> (chunk + 0x1);
+    this -> limit   = this -> cursor + size;
+
+    return this -> allocate (bytes, alignment);
+}
+
+/******************************************************************************/
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Arena` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Arena.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the `Arena` class, a monotonic memory resource for the
+ * bulk creation of objects such as whole scenes of ellipses.
+ *
+ * Objects created within an arena are placed one after another into large
+ * chunks of memory.  Thus, creating an object costs a few instructions instead
+ * of a call to the global heap and all objects are released at once by
+ * releasing the arena.  The library is compiled as C++11 such that `std :: pmr`
+ * is not available.  Consumers using C++17 may wrap an arena into a `std :: pmr
+ * :: memory_resource` by its `allocate` method.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __ARENA_HPP__
+#define __ARENA_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "EXPORT.hpp"
+
+using std :: size_t;
+using std :: uintptr_t;
+
+
+
+/**
+ * \brief   A monotonic memory resource.
+ *
+ * An arena hands out memory from a chunk by advancing a cursor.  When the
+ * current chunk is exhausted, a new one of twice the size is requested from
+ * the global heap.  Memory is only returned by `release` or the destructor,
+ * both of which do not call the destructors of the created objects.  Hence, an
+ * arena is suitable for objects which do not own any further resources, for
+ * instance instances of the `Ellipse` class.
+ *
+ * An arena must not be used by several threads at the same time.
+ */
+
+class Arena
+{
+    public:
+        EXPORT  explicit    Arena   (const size_t capacity);
+        EXPORT              ~Arena  (void);
+
+        Arena (const Arena & other)                 = delete;
+        Arena & operator =  (const Arena & other)   = delete;
+
+        EXPORT  size_t  capacity    (void) const;
+        EXPORT  void    release     (void);
+
+        /**
+         * \brief   Allocate memory from this arena.
+         * \param   bytes       The count of bytes.
+         * \param   alignment   The alignment, a power of two.
+         * \return  The allocated memory.
+         *
+         * The common case is defined in this header such that it can be
+         * inlined.  Only when the current chunk is exhausted, a new one is
+         * requested from the library.
+         */
+
+        void *  allocate    (const size_t bytes, const size_t alignment)
+        {
+            const uintptr_t address
+                {(this -> cursor + alignment - 0x1) & ~(alignment - 0x1)};
+
+            if (address + bytes > this -> limit || address < this -> cursor)
+                return this -> grow (bytes, alignment);
+
+            this -> cursor = address + bytes;
+
+            return reinterpret_cast <void *> (address);
+        }
+
+        /**
+         * \brief   Create an object within this arena.
+         * \param   arguments   The arguments of the constructor.
+         * \return  A pointer to the new object.
+         *
+         * The object is neither destroyed nor freed individually.  It stays
+         * valid until this arena is released.
+         */
+
+        template <typename T, typename ... Arguments>
+        T * create (Arguments && ... arguments)
+        {
+            return new (this -> allocate (sizeof (T), alignof (T)))
+                T (std :: forward <Arguments> (arguments) ...);
+        }
+
+    private:
+        /**
+         * \brief   The header of a chunk.
+         *
+         * The chunks are linked from the newest to the oldest one.  The memory
+         * handed out follows the header.
+         */
+
+        struct Chunk
+        {
+            Chunk * next;
+            size_t  size;
+        };
+
+        Chunk *     chunks;
+        uintptr_t   cursor;
+        uintptr_t   limit;
+
+        EXPORT  void *  grow    (const size_t bytes, const size_t alignment);
+};
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __ARENA_HPP__
+
+/******************************************************************************/
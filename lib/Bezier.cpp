@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The rational quadratic Bezier segments.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Bezier.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Bezier` class.  Since the class
+ * is an auxiliary one, all of its methods are stored in this file.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Bezier.hpp"
+#include "Instrumentation.hpp"
+
+
+
+/**
+ * \brief   Evaluate this segment.
+ * \param   s   The parameter within `[0, 1]`.
+ * \param   x   The x coordinate of the curve point.
+ * \param   y   The y coordinate of the curve point.
+ * \param   z   The z coordinate of the curve point.
+ */
+
+ELLIPSE_INLINE void Bezier :: eval    ( const float s
+                                      , float & x
+                                      , float & y
+                                      , float & z
+                                      ) const
+{
+    this -> eval (& s, 0x1, & x, & y, & z);
+    return;
+}
+
+
+
+/**
+ * \brief   Evaluate this segment for a batch of parameters.
+ * \param   s       The parameters within `[0, 1]`.
+ * \param   count   The count of parameters.
+ * \param   x       The x coordinates of the curve points.
+ * \param   y       The y coordinates of the curve points.
+ * \param   z       The z coordinates of the curve points.
+ *
+ * The control points are multiplied by their weights once.  Then, each curve
+ * point costs three weighted Bernstein polynomials, the homogeneous sums and a
+ * single division, computed in SIMD lanes.
+ */
+
+ELLIPSE_INLINE void Bezier :: eval    ( const float * s
+                                      , const size_t count
+                                      , float * x
+                                      , float * y
+                                      , float * z
+                                      ) const
+{
+    ELLIPSE_TIME ("Bezier :: eval (batch)");
+
+    float   h   [0x3][0x3]  {};
+
+    for (size_t i = 0x0; i < 0x3; i++)
+        for (size_t k = 0x0; k < 0x3; k++)
+            h[i][k] = this -> weights[i] * this -> points[i][k];
+
+    const float w0  {this -> weights[0x0]};
+    const float w1  {this -> weights[0x1]};
+    const float w2  {this -> weights[0x2]};
+
+#pragma omp simd
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const float r       {1.f - s[i]};
+        const float b0      {r * r};
+        const float b1      {2.f * r * s[i]};
+        const float b2      {s[i] * s[i]};
+        const float scale   {1.f / (w0 * b0 + w1 * b1 + w2 * b2)};
+
+        x[i]    = (b0 * h[0x0][0x0] + b1 * h[0x1][0x0] + b2 * h[0x2][0x0])
+                * scale;
+        y[i]    = (b0 * h[0x0][0x1] + b1 * h[0x1][0x1] + b2 * h[0x2][0x1])
+                * scale;
+        z[i]    = (b0 * h[0x0][0x2] + b1 * h[0x1][0x2] + b2 * h[0x2][0x2])
+                * scale;
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Bezier` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Bezier.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the `Bezier` class which describes rational quadratic
+ * Bezier segments.
+ *
+ * Renderers without fast trigonometric functions and CAD exchange formats
+ * describe conic arcs by rational quadratic segments.  Their evaluation only
+ * requires a few multiplications and a single division per point.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __BEZIER_HPP__
+#define __BEZIER_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <cstddef>
+
+#include "EXPORT.hpp"
+
+using std :: size_t;
+
+
+
+/**
+ * \brief   A rational quadratic Bezier segment in 3D space.
+ *
+ * The segment is given by three control points and their weights.  The curve
+ * point of the parameter `s` within `[0, 1]` is
+ * `sum w_i b_i (s) P_i / sum w_i b_i (s)` with the Bernstein polynomials
+ * `b_0 = (1 - s)^2`, `b_1 = 2 s (1 - s)` and `b_2 = s^2`.  Rational quadratic
+ * segments represent conic arcs exactly.
+ *
+ * This class is a plain value type.  It neither allocates memory nor holds any
+ * further state besides the control points and the weights.
+ */
+
+class Bezier
+{
+    public:
+        float   points  [0x3][0x3];
+        float   weights [0x3];
+
+        EXPORT  void    eval    ( const float s
+                                , float & x
+                                , float & y
+                                , float & z
+                                ) const;
+        EXPORT  void    eval    ( const float * s
+                                , const size_t count
+                                , float * x
+                                , float * y
+                                , float * z
+                                ) const;
+};
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __BEZIER_HPP__
+
+/******************************************************************************/
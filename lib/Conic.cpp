@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The implicit representation of conic sections.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Conic.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Conic` class.  Since the class
+ * is an auxiliary one, all of its methods are stored in this file.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Conic.hpp"
+
+
+
+/**
+ * \brief   Create the conic of an ellipse given by its parameters.
+ * \param   cx      The x coordinate of the centre.
+ * \param   cy      The y coordinate of the centre.
+ * \param   major   The semi-major axis.
+ * \param   minor   The semi-minor axis.
+ * \param   angle   The angle between the major axis and the x axis.
+ * \return  The conic of the ellipse.
+ *
+ * The ellipse `u^2 / a^2 + v^2 / b^2 = 1` in its local frame is rotated by
+ * `angle` and translated to the centre.  The result is not normalised such
+ * that the conic evaluates to `-1` at the centre.  Both semi-axes need to be
+ * positive.
+ */
+
+ELLIPSE_INLINE Conic Conic :: from_parameters ( const double cx
+                                              , const double cy
+                                              , const double major
+                                              , const double minor
+                                              , const double angle
+                                              )
+{
+    const double    c   {std :: cos (angle)};
+    const double    s   {std :: sin (angle)};
+    const double    ia  {1. / (major * major)};
+    const double    ib  {1. / (minor * minor)};
+    const double    p   {c * c * ia + s * s * ib};
+    const double    q   {c * s * (ia - ib)};
+    const double    r   {s * s * ia + c * c * ib};
+
+    Conic   ret {};
+
+    ret.matrix[0x0][0x0]    = p;
+    ret.matrix[0x0][0x1]    = q;
+    ret.matrix[0x1][0x1]    = r;
+    ret.matrix[0x0][0x2]    = - (p * cx + q * cy);
+    ret.matrix[0x1][0x2]    = - (q * cx + r * cy);
+    ret.matrix[0x2][0x2]    = p * cx * cx + 2. * q * cx * cy + r * cy * cy - 1.;
+    ret.matrix[0x1][0x0]    = ret.matrix[0x0][0x1];
+    ret.matrix[0x2][0x0]    = ret.matrix[0x0][0x2];
+    ret.matrix[0x2][0x1]    = ret.matrix[0x1][0x2];
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Classify this conic.
+ * \param   tolerance   The relative tolerance of the decisions.
+ * \return  The kind of this conic.
+ *
+ * The conic is classified by the determinant of its quadratic part, which
+ * distinguishes ellipses, parabolas and hyperbolas, and by its value at the
+ * centre, which is zero for degenerate conics.  The determinant is measured
+ * relative to the squared norm of the quadratic part.  The value at the centre
+ * is measured relative to the constant term since this is the magnitude of the
+ * rounding errors when the centre is far off the origin.  Parabolas are
+ * distinguished from parallel lines by the determinant of the normalised
+ * matrix.
+ */
+
+ELLIPSE_INLINE Conic :: Type Conic :: classify (const double tolerance) const
+{
+    const Conic     n       {this -> normalise ()};
+    const double    p       {n.matrix[0x0][0x0]};
+    const double    q       {n.matrix[0x0][0x1]};
+    const double    r       {n.matrix[0x1][0x1]};
+    const double    g       {n.matrix[0x0][0x2]};
+    const double    h       {n.matrix[0x1][0x2]};
+    const double    f       {n.matrix[0x2][0x2]};
+    const double    norm    {p * p + 2. * q * q + r * r};
+    const double    det     {p * r - q * q};
+
+    if (std :: abs (det) <= tolerance * norm)
+    {
+        const double    full
+            { p * (r * f - h * h)
+            - q * (q * f - h * g)
+            + g * (q * h - r * g)
+            };
+
+        return std :: abs (full) <= tolerance ? Conic :: parallel
+                                              : Conic :: parabola;
+    };
+
+    const double    x       {(q * h - r * g) / det};
+    const double    y       {(q * g - p * h) / det};
+    const double    centre  {f + g * x + h * y};
+    const double    scale   {tolerance * (std :: abs (f) + norm)};
+
+    if (det < 0.)
+        return std :: abs (centre) <= scale ? Conic :: lines
+                                            : Conic :: hyperbola;
+
+    return centre < - scale ? Conic :: ellipse
+         : centre > scale   ? Conic :: imaginary
+                            : Conic :: point;
+}
+
+
+
+/**
+ * \brief   Classify this conic with the default tolerance.
+ * \return  The kind of this conic.
+ */
+
+ELLIPSE_INLINE Conic :: Type Conic :: classify (void) const
+{
+    return this -> classify (1e-9);
+}
+
+
+
+/**
+ * \brief   Evaluate the quadratic form of this conic.
+ * \param   x   The x coordinate of the point.
+ * \param   y   The y coordinate of the point.
+ * \return  The algebraic value of the point.
+ *
+ * The value is zero on the conic.  For a normalised ellipse, it is negative
+ * inside and positive outside.
+ */
+
+ELLIPSE_INLINE double Conic :: eval (const double x, const double y) const
+{
+    const double    (& m) [0x3][0x3]    {this -> matrix};
+
+    return m[0x0][0x0] * x * x
+         + 2. * m[0x0][0x1] * x * y
+         + m[0x1][0x1] * y * y
+         + 2. * m[0x0][0x2] * x
+         + 2. * m[0x1][0x2] * y
+         + m[0x2][0x2];
+}
+
+
+
+/**
+ * \brief   Normalise this conic.
+ * \return  The normalised conic.
+ *
+ * The matrix is scaled to unit Frobenius norm.  Its sign is chosen such that
+ * the trace of the quadratic part is positive or, in case it vanishes, such
+ * that the constant term is not positive.  Hence, ellipses evaluate negative
+ * inside.  The zero matrix is returned unchanged.
+ */
+
+ELLIPSE_INLINE Conic Conic :: normalise (void) const
+{
+    Conic   ret     {* this};
+    double  norm    {0.};
+
+    for (size_t i = 0x0; i < 0x3; i++)
+        for (size_t j = 0x0; j < 0x3; j++)
+            norm += this -> matrix[i][j] * this -> matrix[i][j];
+
+    if (norm <= 0.)
+        return ret;
+
+    const double    trace
+        {this -> matrix[0x0][0x0] + this -> matrix[0x1][0x1]};
+    const double    sign
+        { trace < 0. || (trace == 0. && this -> matrix[0x2][0x2] > 0.)
+        ? -1.
+        : 1.
+        };
+
+    for (size_t i = 0x0; i < 0x3; i++)
+        for (size_t j = 0x0; j < 0x3; j++)
+            ret.matrix[i][j] = sign * this -> matrix[i][j] / std :: sqrt (norm);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Determine the parameters of this conic as an ellipse.
+ * \param   cx      The x coordinate of the centre.
+ * \param   cy      The y coordinate of the centre.
+ * \param   major   The semi-major axis.
+ * \param   minor   The semi-minor axis.
+ * \param   angle   The angle between the major axis and the x axis.
+ * \return  Whether this conic is a real ellipse.
+ *
+ * The centre is the solution of the linear system given by the gradient of the
+ * quadratic form.  The semi-axes follow from the eigenvalues of the quadratic
+ * part and the value at the centre.  The major axis points into the direction
+ * of the eigenvector of the lesser eigenvalue.
+ *
+ * In case this conic is not a real ellipse, the parameters are not changed.
+ * The conic does not need to be normalised.
+ */
+
+ELLIPSE_INLINE bool Conic :: parameters ( double & cx
+                                        , double & cy
+                                        , double & major
+                                        , double & minor
+                                        , double & angle
+                                        ) const
+{
+    const double    (& m) [0x3][0x3]    {this -> matrix};
+
+    const double    sign    {m[0x0][0x0] + m[0x1][0x1] < 0. ? -1. : 1.};
+    const double    p       {sign * m[0x0][0x0]};
+    const double    q       {sign * m[0x0][0x1]};
+    const double    r       {sign * m[0x1][0x1]};
+    const double    g       {sign * m[0x0][0x2]};
+    const double    h       {sign * m[0x1][0x2]};
+    const double    det     {p * r - q * q};
+
+    if (! (det > 0.))
+        return false;
+
+    const double    x       {(q * h - r * g) / det};
+    const double    y       {(q * g - p * h) / det};
+    const double    f       {sign * m[0x2][0x2] + g * x + h * y};
+    const double    mean    {0.5 * (p + r)};
+    const double    spread  {std :: sqrt (0.25 * (p - r) * (p - r) + q * q)};
+
+    if (! (mean - spread > 0. && f < 0.))
+        return false;
+
+    cx      = x;
+    cy      = y;
+    major   = std :: sqrt (- f / (mean - spread));
+    minor   = std :: sqrt (- f / (mean + spread));
+    angle   = 0.5 * std :: atan2 (2. * q, p - r) + 1.5707963267948966;
+
+    return true;
+}
+
+/******************************************************************************/
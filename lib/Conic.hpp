@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Conic` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Conic.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the `Conic` class which describes conic sections by
+ * their symmetric 3x3 matrix.
+ *
+ * Many algorithms, such as containment tests, intersections, projections and
+ * fittings, are easier to formulate by the implicit form of a conic than by its
+ * parametrisation.  Hence, ellipses can be converted into conics and back.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __CONIC_HPP__
+#define __CONIC_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <cmath>
+#include <cstddef>
+
+#include "EXPORT.hpp"
+
+using std :: size_t;
+
+
+
+/**
+ * \brief   The implicit representation of a conic section.
+ *
+ * A conic consists of all points `(x, y)` which satisfy
+ * `(x y 1) M (x y 1)^T = 0` for a symmetric 3x3 matrix `M`.  The matrix is
+ * stored completely, including the redundant lower triangle, such that it can
+ * be passed to matrix algorithms directly.  For an ellipse, the points inside
+ * yield negative values.
+ *
+ * This class is a plain value type.  It neither allocates memory nor holds any
+ * further state besides the matrix.
+ */
+
+class Conic
+{
+    public:
+        /**
+         * \brief   The kinds of conics.
+         *
+         * Real conics are `ellipse`, `hyperbola` and `parabola`.  An
+         * `imaginary` conic has no real points.  The degenerate conics are a
+         * single `point`, two intersecting `lines` and two `parallel` lines,
+         * which may also coincide or be imaginary.
+         */
+
+        enum Type
+        {
+            ellipse,
+            imaginary,
+            hyperbola,
+            parabola,
+            point,
+            lines,
+            parallel
+        };
+
+        double  matrix  [0x3][0x3];
+
+        EXPORT  static  Conic   from_parameters ( const double cx
+                                                , const double cy
+                                                , const double major
+                                                , const double minor
+                                                , const double angle
+                                                );
+
+        EXPORT  Type    classify    (const double tolerance) const;
+        EXPORT  Type    classify    (void) const;
+        EXPORT  double  eval        (const double x, const double y) const;
+        EXPORT  Conic   normalise   (void) const;
+        EXPORT  bool    parameters  ( double & cx
+                                    , double & cy
+                                    , double & major
+                                    , double & minor
+                                    , double & angle
+                                    ) const;
+};
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __CONIC_HPP__
+
+/******************************************************************************/
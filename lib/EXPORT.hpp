@@ -6,4 +6,10 @@
 #endif  // ! __MAKE_DLL__
 #else
 #define EXPORT
-#endif  // ! __WINDOWS__
\ No newline at end of file
+#endif  // ! __WINDOWS__
+
+#ifdef  __ELLIPSE_HEADER_ONLY__
+#define ELLIPSE_INLINE inline
+#else
+#define ELLIPSE_INLINE
+#endif  // ! __ELLIPSE_HEADER_ONLY__
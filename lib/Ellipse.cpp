@@ -43,21 +43,20 @@
  * \brief   The default constructor.
  *
  * This constructor will create an empty ellipse which contains just default
- * values.
+ * values.  The default ellipse is the unit circle.
  */
 
-Ellipse :: Ellipse (void)
+ELLIPSE_INLINE Ellipse :: Ellipse (void)
 {
+    ELLIPSE_COUNT ("Ellipse (void)");
+
     this -> init ();
 
-    this -> set_eccentricity ();
-    this -> set_major ();
-    this -> set_minor ();
-    this -> set_radius ();
+    this -> major   = 1.f;
+    this -> minor   = 1.f;
+    this -> radius  = 1.f;
 
-    this -> x   = {[=] (const float t) -> float {return cos (t);}};
-    this -> y   = {[=] (const float t) -> float {return sin (t);}};
-    this -> z   = {[=] (const float t) -> float {return 0.f * t;}};
+    this -> parametrise ();
 
     return;
 }
@@ -91,23 +90,32 @@ Ellipse :: Ellipse (void)
  * Vector.  This aspect is required in order to transform the ellipse properly.
  */
 
-Ellipse :: Ellipse  ( const float r
-                    , const float e
-                    , const float cx
-                    , const float cy
-                    , const float cz
-                    , const float tx
-                    , const float ty
-                    , const float tz
-                    , const float nx
-                    , const float ny
-                    , const float nz
-                    )
+ELLIPSE_INLINE Ellipse :: Ellipse  ( const float r
+                                   , const float e
+                                   , const float cx
+                                   , const float cy
+                                   , const float cz
+                                   , const float tx
+                                   , const float ty
+                                   , const float tz
+                                   , const float nx
+                                   , const float ny
+                                   , const float nz
+                                   )
 {
+    ELLIPSE_COUNT ("Ellipse (parametric)");
+
     this -> init ();
 
-    this -> major   = r + e;
-    this -> minor   = r;
+    this -> eccentricity    = e;
+    this -> major           = r + e;
+    this -> minor           = r;
+    this -> radius          = r;
+
+    this -> set_centre (cx, cy, cz);
+    this -> set_normal (nx, ny, nz);
+    this -> set_tangent (tx, ty, tz);
+    this -> parametrise ();
 
     const float bx  {ty * nz - tz * ny};
     const float by  {tz * nx - tx * nz};
@@ -120,13 +128,6 @@ Ellipse :: Ellipse  ( const float r
     const float alpha   = acos (abs (nz) / sqrt (nx * nx + ny * ny + nz * nz));
     const float beta    = acos (abs (tx) / sqrt (tx * tx + ty * ty + tz * tz));
 
-    const float major   {this -> major};
-    const float minor   {this -> minor};
-
-    this -> x   = [=] (const float t) -> float {return major * cos (t);};
-    this -> y   = [=] (const float t) -> float {return minor * sin (t);};
-    this -> z   = [=] (const float t) -> float {return 0.f * t;};
-
     return;
 
     float none = 0.f;
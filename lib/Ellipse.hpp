@@ -48,36 +48,36 @@
  * Includes.
  */
 
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <vector>
 
+#include "Arena.hpp"
+#include "Bezier.hpp"
+#include "Conic.hpp"
+#include "EXPORT.hpp"
+#include "Instrumentation.hpp"
+#include "Philox.hpp"
+#include "Shared.hpp"
+#include "Stream.hpp"
+#include "Tessellation.hpp"
+#include "Trig.hpp"
+
 using std :: abs;
 using std :: acos;
+using std :: array;
 using std :: cos;
 using std :: function;
 using std :: sin;
+using std :: size_t;
 using std :: sqrt;
 using std :: vector;
 
 
 
-/*
- * Settings.
- */
-
-#ifdef  __WINDOWS__
-#ifdef  __MAKE_DLL__
-#define EXPORT __declspec (dllexport)
-#else
-#define EXPORT __declspec (dllimport)
-#endif  // ! __MAKE_DLL__
-#else
-#define EXPORT
-#endif  // ! __WINDOWS__
-
-
-
 /**
  * \brief   A simple ellipse class.
  *
@@ -95,7 +95,58 @@ using std :: vector;
 
 class Ellipse
 {
+    public:
+        /**
+         * \brief   When to compute the data derived from the geometry.
+         *
+         * With `none`, the setters discard the derived data and the queries
+         * compute what they need on each call.  With `immediate`, every setter
+         * recomputes the derived data at once such that the queries only read
+         * it.  With `deferred`, the setters only mark the derived data as
+         * outdated and the next query recomputes all of it once.
+         */
+
+        enum Caching
+        {
+            none,
+            immediate,
+            deferred
+        };
+
     private:
+        /**
+         * \brief   The data derived from the geometry of an ellipse.
+         *
+         * These values are required by several queries.  They are stored by
+         * `refresh` and valid as long as `cached` is set.
+         */
+
+        struct Derived
+        {
+            double  u           [0x3];
+            double  v           [0x3];
+            Conic   conic;
+            float   width;
+            float   height;
+            float   perimeter;
+        };
+
+        /**
+         * \brief   The placement of an ellipse within the x-y plane.
+         *
+         * The direction of the major axis is stored as its cosine and sine.
+         */
+
+        struct Planar
+        {
+            double  cx;
+            double  cy;
+            double  major;
+            double  minor;
+            double  cosine;
+            double  sine;
+        };
+
         float                           eccentricity;
         float                           major;
         float                           minor;
@@ -103,13 +154,172 @@ class Ellipse
         function <float (const float)>  x;
         function <float (const float)>  y;
         function <float (const float)>  z;
-        vector <float>                  centre;
-        vector <float>                  normal;
-        vector <float>                  tangent;
+        array <float, 0x3>              centre;
+        array <float, 0x3>              normal;
+        array <float, 0x3>              tangent;
+        mutable Derived                 derived;
+        mutable bool                    cached;
+        mutable Caching                 caching;
+
+        EXPORT  static void basis   ( const float * tangent
+                                    , const float * normal
+                                    , double (& u) [0x3]
+                                    , double (& v) [0x3]
+                                    );
 
+        EXPORT  void    basis   (double (& u) [0x3], double (& v) [0x3]) const;
+        EXPORT  bool    cache   (void) const;
+        EXPORT  float   closest (const float x, const float y, float & t) const;
+        EXPORT  void    extent  (float & width, float & height) const;
         EXPORT  void    init    (void);
+        EXPORT  Planar  planar  (void) const;
+
+        EXPORT  static  size_t  quartic ( const double (& p) [0x5]
+                                        , double (& roots) [0x4]
+                                        );
 
     public:
+        /**
+         * \brief   A curve point together with its moving frame.
+         *
+         * The tangent points into the direction of increasing parameter
+         * values.  The normal lies within the ellipse's plane and points away
+         * from the centre.  Both are unit vectors.
+         */
+
+        struct Frame
+        {
+            float   position    [0x3];
+            float   tangent     [0x3];
+            float   normal      [0x3];
+        };
+
+        /**
+         * \brief   The output arrays of a batch evaluation of frames.
+         *
+         * Each component is stored in a separate array such that the batch can
+         * be processed in SIMD lanes.  All arrays need to provide space for
+         * the whole batch.
+         */
+
+        struct Frames
+        {
+            float * position    [0x3];
+            float * tangent     [0x3];
+            float * normal      [0x3];
+            float * curvature;
+        };
+
+        /**
+         * \brief   A batch of ellipses, stored as arrays.
+         *
+         * Each component is stored in a separate array such that the batch can
+         * be processed in SIMD lanes.  All arrays need to provide space for
+         * the whole batch.
+         */
+
+        struct Batch
+        {
+            float * centre  [0x3];
+            float * tangent [0x3];
+            float * normal  [0x3];
+            float * major;
+            float * minor;
+        };
+
+        /**
+         * \brief   A batch of bodies moving on orbits, stored as arrays.
+         *
+         * Each body refers to its orbit by an index and carries its current
+         * mean anomaly.  The positions are written by the propagation.  All
+         * arrays need to provide space for the whole batch.
+         */
+
+        struct Bodies
+        {
+            uint32_t *  orbit;
+            float *     mean;
+            float *     position    [0x3];
+        };
+
+        /**
+         * \brief   A batch of rays or lines, stored as arrays.
+         *
+         * Each ray starts at its origin and runs into the direction which
+         * does not need to be a unit vector.  Lines extend the rays into both
+         * directions.  All arrays need to provide the whole batch.
+         */
+
+        struct Rays
+        {
+            const float *   origin      [0x3];
+            const float *   direction   [0x3];
+        };
+
+        /**
+         * \brief   A batch of planes, stored as arrays.
+         *
+         * A plane consists of all points `p` with `normal . p = offset`.  The
+         * normal does not need to be a unit vector.  All arrays need to
+         * provide the whole batch.
+         */
+
+        struct Planes
+        {
+            const float *   normal  [0x3];
+            const float *   offset;
+        };
+
+        /**
+         * \brief   A closed curve as a non-uniform rational B-spline.
+         *
+         * The control points and their weights are stored in the order of the
+         * curve, where the last control point repeats the first one.  The knot
+         * vector is clamped and normalised to `[0, 1]`.
+         */
+
+        struct Nurbs
+        {
+            size_t                      degree;
+            vector <float>              knots;
+            vector <array <float, 0x3>> points;
+            vector <float>              weights;
+        };
+
+        /**
+         * \brief   A caller-supplied pixel buffer to rasterise into.
+         *
+         * The rows are `stride` bytes apart from each other.  Each pixel
+         * occupies `depth` bits which can be either 8 or 32.
+         */
+
+        struct Image
+        {
+            void *          pixels;
+            size_t          width;
+            size_t          height;
+            size_t          stride;
+            unsigned int    depth;
+        };
+
+        /**
+         * \brief   The pixels to set when rasterising an ellipse.
+         *
+         * `fill` and `outline` write a fixed value into the covered pixels.
+         * `coverage` writes the anti-aliased area coverage and `distance` the
+         * approximate signed distance to the ellipse, both as `float` for
+         * 32-bit images.  The coverage of ellipses whose semi-minor axis is
+         * less than four pixels is scaled such that it sums up to their area.
+         */
+
+        enum Rasterisation
+        {
+            fill,
+            outline,
+            coverage,
+            distance
+        };
+
         EXPORT  Ellipse (void);
         EXPORT  Ellipse ( const float r
                         , const float e
@@ -124,6 +334,29 @@ class Ellipse
                         , const float nz
                         );
 
+        EXPORT  void    cache_conic (void);
+        EXPORT  void    refresh     (void) const;
+
+        EXPORT  static  bool    enclose ( const float * x
+                                        , const float * y
+                                        , const size_t count
+                                        , const float tolerance
+                                        , Ellipse & ellipse
+                                        , const size_t threads
+                                        );
+
+        EXPORT  static  bool    from_conic  ( const Conic & conic
+                                            , Ellipse & ellipse
+                                            );
+        EXPORT  static  size_t  from_conic  ( const Conic * conics
+                                            , const size_t count
+                                            , const Batch & ellipses
+                                            );
+
+        EXPORT  Caching get_caching     (void) const;
+        EXPORT  Conic   get_conic       (void) const;
+        EXPORT  float   get_perimeter   (void) const;
+
         EXPORT  float                           get_eccentricity    (void);
         EXPORT  float                           get_major           (void);
         EXPORT  float                           get_minor           (void);
@@ -135,6 +368,31 @@ class Ellipse
         EXPORT  vector <float>                  get_normal          (void);
         EXPORT  vector <float>                  get_tangent         (void);
 
+        EXPORT  void    sample_area         ( const uint64_t seed
+                                            , const size_t count
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            , const size_t threads
+                                            ) const;
+        EXPORT  void    sample_perimeter    ( const uint64_t seed
+                                            , const size_t count
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            , const size_t threads
+                                            ) const;
+        EXPORT  Stream  samples             ( const float start
+                                            , const float step
+                                            , const size_t count
+                                            ) const;
+        EXPORT  Stream  samples             ( const float start
+                                            , const float step
+                                            , const size_t count
+                                            , const Trig & trig
+                                            ) const;
+
+        EXPORT  void    set_caching         (const Caching caching);
         EXPORT  void    set_centre          (void);
         EXPORT  void    set_centre          (const vector <float> & centre);
         EXPORT  void    set_centre          ( const float x
@@ -162,8 +420,268 @@ class Ellipse
                                             , const float z
                                             );
 
+        EXPORT  size_t  intersect_disk  ( const Rays & rays
+                                        , const size_t count
+                                        , float * distance
+                                        ) const;
+        EXPORT  size_t  intersect_line  ( const Rays & lines
+                                        , const size_t count
+                                        , float * first
+                                        , float * second
+                                        ) const;
+        EXPORT  size_t  intersect_plane ( const Planes & planes
+                                        , const size_t count
+                                        , float * first
+                                        , float * second
+                                        ) const;
+
+        EXPORT  float   iou     (const Ellipse & other) const;
+        EXPORT  float   overlap (const Ellipse & other) const;
+
+        EXPORT  static  size_t  suppress    ( const Ellipse * ellipses
+                                            , const float * scores
+                                            , const size_t count
+                                            , const float threshold
+                                            , size_t * kept
+                                            , const size_t threads
+                                            );
+
+        EXPORT  static  float   kepler  ( const float mean
+                                        , const float eccentricity
+                                        );
+        EXPORT  static  void    kepler  ( const float * mean
+                                        , const float * eccentricity
+                                        , const size_t count
+                                        , float * anomaly
+                                        );
+
+        EXPORT  static  void    propagate   ( const Ellipse * orbits
+                                            , const size_t orbit_count
+                                            , const Bodies & bodies
+                                            , const size_t count
+                                            , const float gravitation
+                                            , const float step
+                                            , const size_t threads
+                                            );
+
+        EXPORT  float   parameter_of    ( const float x
+                                        , const float y
+                                        , const float z
+                                        , const bool refine
+                                        ) const;
+        EXPORT  void    parameter_of    ( const float * x
+                                        , const float * y
+                                        , const float * z
+                                        , const size_t count
+                                        , float * t
+                                        , const bool refine
+                                        ) const;
+
+        EXPORT  bool            project ( const float * camera
+                                        , Ellipse & image
+                                        ) const;
+        EXPORT  static size_t   project ( const float * camera
+                                        , const Batch & ellipses
+                                        , const size_t count
+                                        , const Batch & images
+                                        );
+
+        EXPORT  void    parametrise (void);
+        EXPORT  size_t  place       ( const Tessellation :: Polyline & polyline
+                                    , vector <float> & x
+                                    , vector <float> & y
+                                    , vector <float> & z
+                                    ) const;
+        EXPORT  void    rasterise   ( const Image & image
+                                    , const Rasterisation mode
+                                    , const uint32_t value
+                                    ) const;
+        EXPORT  static void rasterise   ( const Ellipse * ellipses
+                                        , const size_t count
+                                        , const Image & image
+                                        , const Rasterisation mode
+                                        , const uint32_t * values
+                                        , const size_t threads
+                                        );
+
+        EXPORT  size_t  tessellate  ( const float tolerance
+                                    , vector <float> & x
+                                    , vector <float> & y
+                                    , vector <float> & z
+                                    ) const;
+        EXPORT  size_t  tessellate  ( Tessellation & cache
+                                    , const float tolerance
+                                    , vector <float> & x
+                                    , vector <float> & y
+                                    , vector <float> & z
+                                    ) const;
+
+        EXPORT  size_t  tessellate_offset   ( const float distance
+                                            , const float tolerance
+                                            , vector <float> & x
+                                            , vector <float> & y
+                                            , vector <float> & z
+                                            ) const;
+        EXPORT  size_t  tessellate_offset   ( const float * distances
+                                            , const size_t offsets
+                                            , const float tolerance
+                                            , vector <float> & x
+                                            , vector <float> & y
+                                            , vector <float> & z
+                                            , size_t * counts
+                                            ) const;
+
+        EXPORT  static  void    to_conic    ( const Batch & ellipses
+                                            , const size_t count
+                                            , Conic * conics
+                                            );
+
+        EXPORT  Nurbs   to_nurbs    (void) const;
+
+        EXPORT  vector <Bezier> to_rational_bezier
+                                    (const size_t segments) const;
+        EXPORT  static  void    to_rational_bezier  ( const Ellipse * ellipses
+                                                    , const size_t count
+                                                    , const size_t segments
+                                                    , Bezier * beziers
+                                                    );
+
+        EXPORT  static  void    transform   ( const float * affine
+                                            , const Batch & ellipses
+                                            , const size_t count
+                                            , const Batch & results
+                                            , const size_t threads
+                                            );
+
         EXPORT  vector <float> eval (const float t, const float offset);
         EXPORT  vector <float> eval (const float t);
+        EXPORT  vector <float> eval (const float t, const Trig & trig) const;
+        EXPORT  void           eval ( const float * t
+                                    , const size_t count
+                                    , float * x
+                                    , float * y
+                                    , float * z
+                                    ) const;
+        EXPORT  void           eval ( const float * t
+                                    , const size_t count
+                                    , float * x
+                                    , float * y
+                                    , float * z
+                                    , const Trig & trig
+                                    ) const;
+
+        EXPORT  float   eval_curvature  (const float t) const;
+        EXPORT  void    eval_curvature  ( const float * t
+                                        , const size_t count
+                                        , float * curvature
+                                        ) const;
+        EXPORT  void    eval_curvature  ( const float * t
+                                        , const size_t count
+                                        , float * curvature
+                                        , const Trig & trig
+                                        ) const;
+
+        EXPORT  vector <float>  eval_derivative ( const float t
+                                                , const unsigned int order
+                                                ) const;
+        EXPORT  vector <float>  eval_derivative (const float t) const;
+        EXPORT  void            eval_derivative ( const float * t
+                                                , const size_t count
+                                                , const unsigned int order
+                                                , float * dx
+                                                , float * dy
+                                                , float * dz
+                                                ) const;
+        EXPORT  void            eval_derivative ( const float * t
+                                                , const size_t count
+                                                , const unsigned int order
+                                                , float * dx
+                                                , float * dy
+                                                , float * dz
+                                                , const Trig & trig
+                                                ) const;
+
+        EXPORT  vector <float>  eval_offset ( const float t
+                                            , const float distance
+                                            ) const;
+        EXPORT  void            eval_offset ( const float * t
+                                            , const size_t count
+                                            , const float * distances
+                                            , const size_t offsets
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            ) const;
+        EXPORT  void            eval_offset ( const float * t
+                                            , const size_t count
+                                            , const float * distances
+                                            , const size_t offsets
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            , const Trig & trig
+                                            ) const;
+
+        EXPORT  Frame   eval_frame  (const float t) const;
+        EXPORT  void    eval_frame  ( const float * t
+                                    , const size_t count
+                                    , const Frames & frames
+                                    ) const;
+        EXPORT  void    eval_frame  ( const float * t
+                                    , const size_t count
+                                    , const Frames & frames
+                                    , const Trig & trig
+                                    ) const;
+
+        EXPORT  vector <float>  eval_world  (const float t) const;
+        EXPORT  void            eval_world  ( const float * t
+                                            , const size_t count
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            ) const;
+        EXPORT  void            eval_world  ( const float * t
+                                            , const size_t count
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            , const Trig & trig
+                                            ) const;
+
+    private:
+        EXPORT  static  void    kepler  ( const float * mean
+                                        , const float * eccentricity
+                                        , const size_t count
+                                        , float * anomaly
+                                        , float * sine
+                                        , float * cosine
+                                        );
+        EXPORT  static  double  overlap ( const Planar & first
+                                        , const Planar & second
+                                        );
+        EXPORT  void    rasterise   ( const Image & image
+                                    , const Rasterisation mode
+                                    , const uint32_t value
+                                    , const size_t first
+                                    , const size_t last
+                                    ) const;
+        EXPORT  void    shade       ( const Image & image
+                                    , const Rasterisation mode
+                                    , const size_t first
+                                    , const size_t last
+                                    ) const;
+        EXPORT  static  void    store   ( const Batch & ellipses
+                                        , const size_t i
+                                        , const bool valid
+                                        , const double (& parameters) [0x5]
+                                        );
+        EXPORT  static  void    transform   ( const float * affine
+                                            , const Batch & ellipses
+                                            , const Batch & results
+                                            , const size_t first
+                                            , const size_t last
+                                            );
+        EXPORT  void    update  (void);
 };
 
 
@@ -176,6 +694,83 @@ class Ellipse
 #ifndef __ELLIPSE_INTERNAL__
 #endif  // ! __ELLIPSE_INTERNAL__
 
+// Header-only mode.
+#ifdef  __ELLIPSE_HEADER_ONLY__
+#include "Ellipse.cpp"
+#include "Arena.cpp"
+#include "Bezier.cpp"
+#include "Conic.cpp"
+#include "Instrumentation.cpp"
+#include "Shared.cpp"
+#include "Stream.cpp"
+#include "Tessellation.cpp"
+#include "Trig.cpp"
+#include "basis.cpp"
+#include "cache.cpp"
+#include "cache_conic.cpp"
+#include "closest.cpp"
+#include "ellipse_c.cpp"
+#include "enclose.cpp"
+#include "eval.cpp"
+#include "eval_curvature.cpp"
+#include "eval_derivative.cpp"
+#include "eval_frame.cpp"
+#include "eval_offset.cpp"
+#include "eval_world.cpp"
+#include "extent.cpp"
+#include "from_conic.cpp"
+#include "get_caching.cpp"
+#include "get_centre.cpp"
+#include "get_conic.cpp"
+#include "get_eccentricity.cpp"
+#include "get_major.cpp"
+#include "get_minor.cpp"
+#include "get_normal.cpp"
+#include "get_perimeter.cpp"
+#include "get_radius.cpp"
+#include "get_tangent.cpp"
+#include "get_x.cpp"
+#include "get_y.cpp"
+#include "get_z.cpp"
+#include "init.cpp"
+#include "intersect_disk.cpp"
+#include "intersect_line.cpp"
+#include "intersect_plane.cpp"
+#include "iou.cpp"
+#include "kepler.cpp"
+#include "overlap.cpp"
+#include "parameter_of.cpp"
+#include "parametrise.cpp"
+#include "place.cpp"
+#include "planar.cpp"
+#include "project.cpp"
+#include "propagate.cpp"
+#include "quartic.cpp"
+#include "rasterise.cpp"
+#include "refresh.cpp"
+#include "sample_area.cpp"
+#include "sample_perimeter.cpp"
+#include "samples.cpp"
+#include "set_caching.cpp"
+#include "set_centre.cpp"
+#include "set_eccentricity.cpp"
+#include "set_major.cpp"
+#include "set_minor.cpp"
+#include "set_normal.cpp"
+#include "set_radius.cpp"
+#include "set_tangent.cpp"
+#include "shade.cpp"
+#include "store.cpp"
+#include "suppress.cpp"
+#include "tessellate.cpp"
+#include "tessellate_offset.cpp"
+#include "to_conic.cpp"
+#include "to_nurbs.cpp"
+#include "to_rational_bezier.cpp"
+#include "transform.cpp"
+#include "update.cpp"
+#endif  // ! __ELLIPSE_HEADER_ONLY__
+
 // Leaving the header.
 #endif  // ! __ELLIPSE_HPP__
 
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The runtime instrumentation of the library.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Instrumentation.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Instrumentation` class.  Since
+ * the class is an auxiliary one, all of its methods are stored in this file.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Instrumentation.hpp"
+
+
+
+/**
+ * \brief   Create and register a new call counter.
+ * \param   name    The name of the counted method.
+ *
+ * The counter is prepended to the global list of counters.  This is done
+ * without locking such that counters can be created by any thread.
+ */
+
+ELLIPSE_INLINE Instrumentation :: Counter :: Counter (const char * name)
+    : name  (name)
+    , calls (0x0)
+    , next  (nullptr)
+{
+    atomic <Counter *> &    head    {Instrumentation :: counters ()};
+
+    this -> next = head.load ();
+    while (! head.compare_exchange_weak (this -> next, this));
+
+    return;
+}
+
+
+
+/**
+ * \brief   Create and register a new latency histogram.
+ * \param   name    The name of the measured kernel.
+ *
+ * The histogram is prepended to the global list of histograms.  This is done
+ * without locking such that histograms can be created by any thread.
+ */
+
+ELLIPSE_INLINE Instrumentation :: Histogram :: Histogram (const char * name)
+    : name  (name)
+    , count (0x0)
+    , total (0x0)
+    , next  (nullptr)
+{
+    for (size_t i = 0x0; i < Histogram :: buckets; i++)
+        this -> bucket[i].store (0x0);
+
+    atomic <Histogram *> &  head    {Instrumentation :: histograms ()};
+
+    this -> next = head.load ();
+    while (! head.compare_exchange_weak (this -> next, this));
+
+    return;
+}
+
+
+
+/**
+ * \brief   Record a measured latency.
+ * \param   nanoseconds The measured latency.
+ */
+
+ELLIPSE_INLINE
+void Instrumentation :: Histogram :: record (const uint64_t nanoseconds)
+{
+    size_t index {0x0};
+
+    while (index + 0x1 < Histogram :: buckets && nanoseconds >> (index + 0x1))
+        index++;
+
+    this -> count.fetch_add (0x1, std :: memory_order_relaxed);
+    this -> total.fetch_add (nanoseconds, std :: memory_order_relaxed);
+    this -> bucket[index].fetch_add (0x1, std :: memory_order_relaxed);
+
+    return;
+}
+
+
+
+/**
+ * \brief   Track memory allocated by the library.
+ * \param   bytes   The count of allocated bytes.
+ */
+
+ELLIPSE_INLINE void Instrumentation :: allocate (const size_t bytes)
+{
+    Instrumentation :: allocations ().fetch_add
+        (0x1, std :: memory_order_relaxed);
+    Instrumentation :: allocated ().fetch_add
+        (bytes, std :: memory_order_relaxed);
+
+    return;
+}
+
+
+
+/**
+ * \brief   The global allocation count.
+ * \return  A reference to the counter.
+ */
+
+ELLIPSE_INLINE atomic <uint64_t> & Instrumentation :: allocations (void)
+{
+    static atomic <uint64_t> ret {0x0};
+    return ret;
+}
+
+
+
+/**
+ * \brief   The global count of allocated bytes.
+ * \return  A reference to the counter.
+ */
+
+ELLIPSE_INLINE atomic <uint64_t> & Instrumentation :: allocated (void)
+{
+    static atomic <uint64_t> ret {0x0};
+    return ret;
+}
+
+
+
+/**
+ * \brief   The head of the list of counters.
+ * \return  A reference to the head.
+ */
+
+ELLIPSE_INLINE
+atomic <Instrumentation :: Counter *> & Instrumentation :: counters (void)
+{
+    static atomic <Counter *> ret {nullptr};
+    return ret;
+}
+
+
+
+/**
+ * \brief   Whether the library was compiled with instrumentation.
+ * \return  `true`, if the measurement points are active.
+ */
+
+ELLIPSE_INLINE bool Instrumentation :: enabled (void)
+{
+#ifdef  __ELLIPSE_INSTRUMENTATION__
+    return true;
+#else
+    return false;
+#endif  // ! __ELLIPSE_INSTRUMENTATION__
+}
+
+
+
+/**
+ * \brief   The head of the list of histograms.
+ * \return  A reference to the head.
+ */
+
+ELLIPSE_INLINE
+atomic <Instrumentation :: Histogram *> & Instrumentation :: histograms (void)
+{
+    static atomic <Histogram *> ret {nullptr};
+    return ret;
+}
+
+
+
+/**
+ * \brief   Reset all measurement points to zero.
+ *
+ * The measurement points remain registered.  Concurrent updates may or may not
+ * be included in the values after the reset.
+ */
+
+ELLIPSE_INLINE void Instrumentation :: reset (void)
+{
+    for (Counter * c = Instrumentation :: counters ().load (); c; c = c -> next)
+        c -> calls.store (0x0, std :: memory_order_relaxed);
+
+    for ( Histogram * h = Instrumentation :: histograms ().load ()
+        ; h
+        ; h = h -> next
+        )
+    {
+        h -> count.store (0x0, std :: memory_order_relaxed);
+        h -> total.store (0x0, std :: memory_order_relaxed);
+
+        for (size_t i = 0x0; i < Histogram :: buckets; i++)
+            h -> bucket[i].store (0x0, std :: memory_order_relaxed);
+    };
+
+    Instrumentation :: allocations ().store (0x0, std :: memory_order_relaxed);
+    Instrumentation :: allocated ().store (0x0, std :: memory_order_relaxed);
+
+    return;
+}
+
+
+
+/**
+ * \brief   Copy the current values of all measurement points.
+ * \return  The snapshot.
+ *
+ * Only measurement points which were reached at least once are contained in
+ * the snapshot since they register themselves on their first use.  Trailing
+ * empty buckets of the histograms are omitted.
+ */
+
+ELLIPSE_INLINE Instrumentation :: Snapshot Instrumentation :: snapshot (void)
+{
+    Snapshot    ret {};
+
+    for (Counter * c = Instrumentation :: counters ().load (); c; c = c -> next)
+    {
+        Snapshot :: Calls   calls   {};
+
+        calls.name  = c -> name;
+        calls.calls = c -> calls.load (std :: memory_order_relaxed);
+
+        ret.counters.push_back (calls);
+    };
+
+    for ( Histogram * h = Instrumentation :: histograms ().load ()
+        ; h
+        ; h = h -> next
+        )
+    {
+        Snapshot :: Latency latency {};
+
+        latency.name    = h -> name;
+        latency.count   = h -> count.load (std :: memory_order_relaxed);
+        latency.total   = h -> total.load (std :: memory_order_relaxed);
+
+        for (size_t i = 0x0; i < Histogram :: buckets; i++)
+            latency.buckets.push_back
+                (h -> bucket[i].load (std :: memory_order_relaxed));
+
+        while (! latency.buckets.empty () && ! latency.buckets.back ())
+            latency.buckets.pop_back ();
+
+        ret.histograms.push_back (latency);
+    };
+
+    ret.allocations = Instrumentation :: allocations ().load ();
+    ret.allocated   = Instrumentation :: allocated ().load ();
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Instrumentation` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Instrumentation.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the optional runtime instrumentation of the library.
+ *
+ * The library counts the calls of its public methods, records the latencies of
+ * its batch kernels and tracks the bytes it allocates.  This is only done in
+ * case the library was compiled with `__ELLIPSE_INSTRUMENTATION__` defined.
+ * Otherwise, the instrumentation macros expand to nothing and a snapshot will
+ * be empty.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __INSTRUMENTATION_HPP__
+#define __INSTRUMENTATION_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "EXPORT.hpp"
+
+using std :: atomic;
+using std :: size_t;
+using std :: string;
+using std :: uint64_t;
+using std :: vector;
+
+
+
+/**
+ * \brief   The runtime instrumentation of the library.
+ *
+ * All measurement points register themselves in global lists on their first
+ * use.  Updating them is a single relaxed atomic operation such that they can
+ * be shared by any count of threads.  The current values can be obtained at any
+ * time by a snapshot.
+ *
+ * The allocations are tracked by `ELLIPSE_ALLOCATE` where the library creates
+ * its working buffers and result containers, with the size they are created
+ * with.  Containers which grow while a kernel runs, such as the bins of the
+ * rasteriser or the pairs found by the non-maximum suppression, are tracked
+ * once by their final capacity.  Hence, the tracked values are a lower bound:
+ * the intermediate reallocations of growing containers, the threads of the
+ * worker pools including their stacks and the internal allocations of the
+ * standard library, for instance by `std :: shared_ptr`, are not tracked.
+ */
+
+class Instrumentation
+{
+    public:
+        /**
+         * \brief   A call counter.
+         *
+         * There is one counter per instrumented method.
+         */
+
+        struct Counter
+        {
+            const char *        name;
+            atomic <uint64_t>   calls;
+            Counter *           next;
+
+            EXPORT  Counter (const char * name);
+
+            /**
+             * \brief   Count one call.
+             */
+
+            void add (void)
+            {
+                this -> calls.fetch_add (0x1, std :: memory_order_relaxed);
+            }
+        };
+
+        /**
+         * \brief   A latency histogram.
+         *
+         * Bucket `i` counts the calls which took between `2^i` and `2^(i+1)`
+         * nanoseconds.
+         */
+
+        struct Histogram
+        {
+            static const size_t buckets = 0x28;
+
+            const char *        name;
+            atomic <uint64_t>   count;
+            atomic <uint64_t>   total;
+            atomic <uint64_t>   bucket  [buckets];
+            Histogram *         next;
+
+            EXPORT  Histogram (const char * name);
+
+            EXPORT  void    record  (const uint64_t nanoseconds);
+        };
+
+        /**
+         * \brief   Record the lifetime of this object in a histogram.
+         *
+         * This is used in order to measure the enclosing scope.
+         */
+
+        class Timer
+        {
+            private:
+                Histogram &                                         histogram;
+                std :: chrono :: steady_clock :: time_point         begin;
+
+            public:
+                Timer (Histogram & histogram)
+                    : histogram (histogram)
+                    , begin     (std :: chrono :: steady_clock :: now ())
+                {}
+
+                ~Timer (void)
+                {
+                    this -> histogram.record
+                        (std :: chrono :: duration_cast
+                            <std :: chrono :: nanoseconds>
+                            (std :: chrono :: steady_clock :: now ()
+                                - this -> begin).count ());
+                }
+        };
+
+        /**
+         * \brief   The values of all measurement points at a certain time.
+         *
+         * The snapshot is a plain copy of the values such that it can be
+         * exported to any metrics system.
+         */
+
+        struct Snapshot
+        {
+            struct Calls
+            {
+                string      name;
+                uint64_t    calls;
+            };
+
+            struct Latency
+            {
+                string              name;
+                uint64_t            count;
+                uint64_t            total;
+                vector <uint64_t>   buckets;
+            };
+
+            vector <Calls>      counters;
+            vector <Latency>    histograms;
+            uint64_t            allocations;
+            uint64_t            allocated;
+        };
+
+        EXPORT  static  void        allocate    (const size_t bytes);
+        EXPORT  static  bool        enabled     (void);
+        EXPORT  static  void        reset       (void);
+        EXPORT  static  Snapshot    snapshot    (void);
+
+    private:
+        EXPORT  static  atomic <Counter *> &    counters    (void);
+        EXPORT  static  atomic <Histogram *> &  histograms  (void);
+        EXPORT  static  atomic <uint64_t> &     allocations (void);
+        EXPORT  static  atomic <uint64_t> &     allocated   (void);
+};
+
+
+
+/*
+ * Measurement points.
+ */
+
+#ifdef  __ELLIPSE_INSTRUMENTATION__
+#define ELLIPSE_COUNT(name)                                                 \
+    do                                                                      \
+    {                                                                       \
+        static Instrumentation :: Counter   counter {name};                 \
+        counter.add ();                                                     \
+    }                                                                       \
+    while (0x0)
+#define ELLIPSE_TIME(name)                                                  \
+    static Instrumentation :: Histogram     histogram {name};               \
+    const Instrumentation :: Timer          timer {histogram}
+#define ELLIPSE_ALLOCATE(bytes)                                             \
+    Instrumentation :: allocate (bytes)
+#else
+#define ELLIPSE_COUNT(name)
+#define ELLIPSE_TIME(name)
+#define ELLIPSE_ALLOCATE(bytes)
+#endif  // ! __ELLIPSE_INSTRUMENTATION__
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __INSTRUMENTATION_HPP__
+
+/******************************************************************************/
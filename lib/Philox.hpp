@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Philox` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Philox.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the `Philox` class, the counter-based random number
+ * generator Philox4x32-10 by Salmon et al.
+ *
+ * A counter-based generator maps a counter and a key to random numbers without
+ * any further state.  Hence, the random numbers for the `i`-th sample can be
+ * computed directly from `i`, such that batches can be processed in SIMD lanes
+ * and distributed among threads without changing the result.  Since the
+ * generator is called from within the SIMD loops of other translation units,
+ * it is defined in this header such that it can be inlined.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __PHILOX_HPP__
+#define __PHILOX_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <cstdint>
+
+using std :: uint32_t;
+using std :: uint64_t;
+
+
+
+
+/**
+ * \brief   The counter-based random number generator Philox4x32-10.
+ *
+ * This class is a plain collection of static functions.  It does not hold any
+ * state.
+ */
+
+class Philox
+{
+    public:
+        /**
+         * \brief   Generate four random numbers.
+         * \param   counter The counter, for instance the index of a sample.
+         * \param   key     The key, for instance the seed of a stream.
+         * \param   result  The four random numbers.
+         *
+         * The counter occupies the lower two words of the 128 bit counter
+         * block, the upper two words are zero.  Ten rounds are applied, each
+         * consisting of two 32 bit multiplications and a key addition.
+         */
+
+        static void generate    ( const uint64_t counter
+                                , const uint64_t key
+                                , uint32_t (& result) [0x4]
+                                )
+        {
+            uint32_t    c0  {uint32_t (counter)};
+            uint32_t    c1  {uint32_t (counter >> 0x20)};
+            uint32_t    c2  {0x0};
+            uint32_t    c3  {0x0};
+            uint32_t    k0  {uint32_t (key)};
+            uint32_t    k1  {uint32_t (key >> 0x20)};
+
+            for (unsigned int round = 0x0; round < 0xa; round++)
+            {
+                const uint64_t  p0  {uint64_t (0xd2511f53) * c0};
+                const uint64_t  p1  {uint64_t (0xcd9e8d57) * c2};
+
+                c0  = uint32_t (p1 >> 0x20) ^ c1 ^ k0;
+                c1  = uint32_t (p1);
+                c2  = uint32_t (p0 >> 0x20) ^ c3 ^ k1;
+                c3  = uint32_t (p0);
+                k0  += 0x9e3779b9;
+                k1  += 0xbb67ae85;
+            };
+
+            result[0x0] = c0;
+            result[0x1] = c1;
+            result[0x2] = c2;
+            result[0x3] = c3;
+        }
+
+        /**
+         * \brief   Map a random number to a uniform `float`.
+         * \param   value   The random number.
+         * \return  A uniformly distributed value within `[0, 1)`.
+         *
+         * The upper 24 bits are used since these are exactly representable.
+         */
+
+        static float uniform (const uint32_t value)
+        {
+            return float (int (value >> 0x8)) * 5.9604645e-8f;
+        }
+};
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __PHILOX_HPP__
+
+/******************************************************************************/
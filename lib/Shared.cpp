@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The ellipses shared between threads by snapshots.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Shared.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Shared` class which are not
+ * required to be inlined, that is, the ones of the writers.  Since the class is
+ * an auxiliary one, all of these methods are stored in this file.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Share a copy of an ellipse.
+ * \param   ellipse The first version.
+ */
+
+ELLIPSE_INLINE Shared :: Shared (const Ellipse & ellipse)
+    : current   (nullptr)
+    , epoch     (0x1)
+    , writer    ()
+    , retired   ()
+{
+    ELLIPSE_ALLOCATE (sizeof (Ellipse));
+
+    for (size_t i = 0x0; i < Shared :: slot_count; i++)
+        this -> slots[i].epoch.store (0x0);
+
+    Ellipse * const version {new Ellipse (ellipse)};
+
+    version -> refresh ();
+    this -> current.store (version);
+
+    return;
+}
+
+
+
+/**
+ * \brief   Free the current and all retired versions.
+ *
+ * No reader must be active anymore.
+ */
+
+ELLIPSE_INLINE Shared :: ~Shared (void)
+{
+    delete this -> current.load ();
+
+    for (const Retired & retired : this -> retired)
+        delete retired.version;
+
+    return;
+}
+
+
+
+/**
+ * \brief   Publish a copy of an ellipse as the next version.
+ * \param   ellipse The next version.
+ */
+
+ELLIPSE_INLINE void Shared :: publish (const Ellipse & ellipse)
+{
+    ELLIPSE_COUNT ("Shared :: publish");
+    ELLIPSE_ALLOCATE (sizeof (Ellipse));
+
+    Ellipse * const                     version {new Ellipse (ellipse)};
+    std :: lock_guard <std :: mutex>    lock    (this -> writer);
+
+    this -> replace (version);
+
+    return;
+}
+
+
+
+/**
+ * \brief   Replace the current version and reclaim retired ones.
+ * \param   version The next version.
+ *
+ * The writer mutex needs to be held.  The replaced version is retired with
+ * the epoch before its replacement.  A reader which pinned epoch `e` can only
+ * have loaded versions retired at epoch `e` or later since the epoch is read
+ * before the version and advanced after the replacement.  Hence, all versions
+ * retired before the oldest pinned epoch are freed.
+ *
+ * The derived data of the next version is computed before it is published
+ * such that the readers' queries never write to it.
+ */
+
+ELLIPSE_INLINE void Shared :: replace (const Ellipse * version)
+{
+    version -> refresh ();
+
+    const Ellipse * const   replaced    {this -> current.exchange (version)};
+    const uint64_t          epoch       {this -> epoch.fetch_add (0x1)};
+
+    this -> retired.push_back ({replaced, epoch});
+
+    uint64_t    oldest  {UINT64_MAX};
+
+    for (size_t i = 0x0; i < Shared :: slot_count; i++)
+    {
+        const uint64_t  pinned  {this -> slots[i].epoch.load ()};
+
+        if (pinned && pinned < oldest)
+            oldest = pinned;
+    };
+
+    size_t  kept    {0x0};
+
+    for (const Retired & retired : this -> retired)
+        if (retired.epoch < oldest)
+            delete retired.version;
+        else
+            this -> retired[kept++] = retired;
+
+    this -> retired.resize (kept);
+
+    return;
+}
+
+
+
+/**
+ * \brief   Start modifying a copy of the current version.
+ * \param   shared  The shared ellipse to modify.
+ *
+ * Other writers are blocked until this writer is destroyed.
+ */
+
+ELLIPSE_INLINE Shared :: Writer :: Writer (Shared & shared)
+    : shared    (shared)
+    , lock      (shared.writer)
+    , version   (nullptr)
+{
+    ELLIPSE_ALLOCATE (sizeof (Ellipse));
+
+    this -> version = new Ellipse (*shared.current.load ());
+
+    return;
+}
+
+
+
+/**
+ * \brief   Publish the modified copy as the next version.
+ */
+
+ELLIPSE_INLINE Shared :: Writer :: ~Writer (void)
+{
+    ELLIPSE_COUNT ("Shared :: Writer");
+
+    this -> shared.replace (this -> version);
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Shared` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Shared.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the `Shared` class which shares an ellipse between
+ * many reading threads and a writing one.
+ *
+ * Readers evaluate an immutable version of the ellipse which is published
+ * atomically.  Writers copy the current version, modify the copy and publish it
+ * as the next version.  Versions which might still be read are retired and only
+ * freed once all readers which could have obtained them have finished, as
+ * determined by epochs.  Thus, readers neither lock nor wait for writers.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __SHARED_HPP__
+#define __SHARED_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "EXPORT.hpp"
+
+using std :: atomic;
+using std :: size_t;
+using std :: uint64_t;
+using std :: vector;
+
+
+
+/*
+ * Forward declarations.
+ */
+
+class Ellipse;
+
+
+
+/**
+ * \brief   An ellipse shared between threads by snapshots.
+ *
+ * The current version is an immutable `Ellipse` which is replaced as a whole
+ * by writers.  A reader pins the current epoch in one of 64 slots before
+ * loading the current version and clears its slot when done.  A writer
+ * publishes the next version, advances the epoch and frees all retired
+ * versions whose epoch is older than the oldest pinned one.
+ *
+ * Reading costs two atomic loads, a compare-and-swap and a store on a slot
+ * which is usually only used by the same thread.  Hence, reads scale with the
+ * count of cores.  Readers never wait for writers, only for each other in case
+ * more than 64 reads are active at the same time.  Writers are serialised
+ * among each other by a mutex.
+ *
+ * Since the slots are aligned to cache lines, so is this class.  Automatic and
+ * static instances are placed accordingly.  Before C++17, `new` does not
+ * respect this alignment, hence, instances on the heap need to be created in
+ * suitably aligned storage.
+ */
+
+class Shared
+{
+    private:
+        /**
+         * \brief   The epoch pinned by a reader, or zero.
+         *
+         * Each slot is aligned to a cache line of its own such that readers on
+         * different cores do not interfere.
+         */
+
+        struct alignas (0x40) Slot
+        {
+            atomic <uint64_t>   epoch;
+        };
+
+        /**
+         * \brief   A replaced version which might still be read.
+         */
+
+        struct Retired
+        {
+            const Ellipse * version;
+            uint64_t        epoch;
+        };
+
+        static const size_t slot_count  {0x40};
+
+        atomic <const Ellipse *>    current;
+        atomic <uint64_t>           epoch;
+        mutable Slot                slots   [slot_count];
+        std :: mutex                writer;
+        vector <Retired>            retired;
+
+        EXPORT  void    replace (const Ellipse * version);
+
+        /**
+         * \brief   The slot a thread tries first.
+         * \return  An index which differs between the first 64 threads.
+         */
+
+        static size_t   hint    (void)
+        {
+            static atomic <size_t>              next    {0x0};
+            static thread_local const size_t    ret     {next++};
+
+            return ret;
+        }
+
+        /**
+         * \brief   Pin the current epoch in a free slot.
+         * \return  The occupied slot.
+         */
+
+        Slot *  pin (void) const
+        {
+            const uint64_t  epoch   {this -> epoch.load ()};
+
+            for (size_t i = Shared :: hint (); ; i++)
+            {
+                Slot &      slot    {this -> slots[i % Shared :: slot_count]};
+                uint64_t    idle    {0x0};
+
+                if (slot.epoch.compare_exchange_strong (idle, epoch))
+                    return & slot;
+            };
+        }
+
+    public:
+        /**
+         * \brief   A pinned version for reading.
+         *
+         * The version stays valid and unchanged until the reader is
+         * destroyed, even if writers publish further versions meanwhile.
+         * Readers should be short-lived since they delay the reclamation of
+         * retired versions.
+         */
+
+        class Reader
+        {
+            public:
+                explicit Reader (const Shared & shared)
+                    : slot      (shared.pin ())
+                    , version   (shared.current.load ())
+                {
+                    return;
+                }
+
+                Reader (Reader && other)
+                    : slot      (other.slot)
+                    , version   (other.version)
+                {
+                    other.slot = nullptr;
+                    return;
+                }
+
+                Reader (const Reader & other)               = delete;
+                Reader & operator = (const Reader & other)  = delete;
+
+                ~Reader (void)
+                {
+                    if (this -> slot)
+                        this -> slot -> epoch.store
+                            (0x0, std :: memory_order_release);
+
+                    return;
+                }
+
+                const Ellipse & operator *  (void) const
+                {
+                    return *this -> version;
+                }
+
+                const Ellipse * operator -> (void) const
+                {
+                    return this -> version;
+                }
+
+            private:
+                Slot *          slot;
+                const Ellipse * version;
+        };
+
+        /**
+         * \brief   A copy of the current version for modification.
+         *
+         * The copy is published as the next version when the writer is
+         * destroyed.  Other writers are blocked meanwhile, readers are not.
+         */
+
+        class Writer
+        {
+            public:
+                EXPORT  explicit    Writer  (Shared & shared);
+                EXPORT              ~Writer (void);
+
+                Writer (const Writer & other)               = delete;
+                Writer & operator = (const Writer & other)  = delete;
+
+                Ellipse &   operator *  (void) const
+                {
+                    return *this -> version;
+                }
+
+                Ellipse *   operator -> (void) const
+                {
+                    return this -> version;
+                }
+
+            private:
+                Shared &                            shared;
+                std :: lock_guard <std :: mutex>    lock;
+                Ellipse *                           version;
+        };
+
+        EXPORT  explicit    Shared  (const Ellipse & ellipse);
+        EXPORT              ~Shared (void);
+
+        Shared (const Shared & other)               = delete;
+        Shared & operator = (const Shared & other)  = delete;
+
+        EXPORT  void    publish (const Ellipse & ellipse);
+
+        /**
+         * \brief   Pin the current version for reading.
+         * \return  The reader.
+         *
+         * This method is defined in this header such that reads do not call
+         * into the library.
+         */
+
+        Reader  read    (void) const
+        {
+            return Reader (*this);
+        }
+};
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __SHARED_HPP__
+
+/******************************************************************************/
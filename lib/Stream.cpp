@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The lazy range of equidistant curve points.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Stream.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Stream` class which are not
+ * required to be inlined.  Since the class is an auxiliary one, all of these
+ * methods are stored in this file.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Create a stream of equidistant curve points.
+ * \param   ellipse The ellipse to evaluate.
+ * \param   start   The parameter value of the first point.
+ * \param   step    The difference of the parameter values of two points.
+ * \param   count   The count of points, or `SIZE_MAX` for an unbounded stream.
+ * \param   trig    The backend computing the sines and the cosines.
+ *
+ * No point is evaluated before the stream is begun.
+ */
+
+ELLIPSE_INLINE Stream :: Stream ( const Ellipse & ellipse
+                                , const float start
+                                , const float step
+                                , const size_t count
+                                , const Trig & trig
+                                )
+    : ellipse   (& ellipse)
+    , trig      (trig)
+    , start     (start)
+    , step      (step)
+    , count     (count)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Evaluate the block of points starting at a certain index.
+ * \param   first   The index of the first point of the block.
+ *
+ * The parameter value of the first point is computed in double precision and
+ * reduced to a single period before the remaining ones are derived from it.
+ * Hence, the parameter values do not lose their precision for long streams and
+ * stay within the range of the approximating backends of `Trig`.
+ */
+
+ELLIPSE_INLINE void Stream :: refill (const size_t first)
+{
+    const size_t    rest    {this -> count - first};
+    const size_t    size    {rest < Stream :: block ? rest : Stream :: block};
+    const double    phase
+        {std :: remainder   ( this -> start + double (first) * this -> step
+                            , 6.283185307179586
+                            )};
+    const double    step    {this -> step};
+
+    float   t   [Stream :: block];
+
+#pragma omp simd
+    for (size_t i = 0x0; i < size; i++)
+        t[i] = float (phase + double (i) * step);
+
+    this -> ellipse -> eval ( t
+                            , size
+                            , this -> x
+                            , this -> y
+                            , this -> z
+                            , this -> trig
+                            );
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,419 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Stream` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Stream.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the `Stream` class, a lazy range of equidistant curve
+ * points of an ellipse.
+ *
+ * Consumers which feed curve points into a pipeline do not need to materialise
+ * them in advance.  Instead, a stream evaluates its points on demand in blocks
+ * of 64 points by the batch kernel of the `Ellipse` class.  Thus, it neither
+ * allocates memory nor grows with the count of points, such that even unbounded
+ * streams can be iterated in constant memory.
+ *
+ * When compiled as C++20 with coroutine support, this header additionally
+ * provides a generator yielding the points of a stream.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __STREAM_HPP__
+#define __STREAM_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#if __cplusplus >= 202002L && defined (__cpp_impl_coroutine)
+#include <coroutine>
+#endif  // ! __cpp_impl_coroutine
+
+#include "EXPORT.hpp"
+#include "Trig.hpp"
+
+using std :: ptrdiff_t;
+using std :: size_t;
+
+
+
+/*
+ * Forward declarations.
+ */
+
+class Ellipse;
+
+
+
+/**
+ * \brief   A lazy range of equidistant curve points.
+ *
+ * The `i`-th point of a stream is the evaluation of the ellipse at the
+ * parameter value `start + i * step`.  The points are computed in blocks of 64
+ * points into a buffer within the stream.  The iterators only refer to this
+ * buffer, hence, a stream is an input range which can be passed once at a
+ * time.  Each call of `begin` restarts the stream.
+ *
+ * A stream refers to its ellipse without copying it.  Therefore, the ellipse
+ * needs to outlive the stream and must not be changed while iterating.
+ */
+
+class Stream
+{
+    public:
+        /**
+         * \brief   A curve point.
+         */
+
+        struct Point
+        {
+            float   x;
+            float   y;
+            float   z;
+        };
+
+        /**
+         * \brief   An input iterator over the points of a stream.
+         *
+         * The hot operations are defined in this header such that iterating a
+         * stream only calls into the library once per block.  The next block
+         * is computed as soon as the iterator leaves the current one.
+         */
+
+        class iterator
+        {
+            public:
+                using difference_type   = ptrdiff_t;
+                using iterator_category = std :: input_iterator_tag;
+                using pointer           = const Point *;
+                using reference         = Point;
+                using value_type        = Point;
+
+                iterator (void)
+                    : stream    (nullptr)
+                    , index     (0x0)
+                {
+                    return;
+                }
+
+                iterator (Stream * stream, const size_t index)
+                    : stream    (stream)
+                    , index     (index)
+                {
+                    return;
+                }
+
+                Point   operator *  (void) const
+                {
+                    const size_t    i   {this -> index & Stream :: mask};
+
+                    return  { this -> stream -> x[i]
+                            , this -> stream -> y[i]
+                            , this -> stream -> z[i]
+                            };
+                }
+
+                iterator &  operator ++ (void)
+                {
+                    this -> index++;
+
+                    if  (  ! (this -> index & Stream :: mask)
+                        && this -> index < this -> stream -> count
+                        )
+                        this -> stream -> refill (this -> index);
+
+                    return *this;
+                }
+
+                iterator    operator ++ (int)
+                {
+                    const iterator  ret {*this};
+
+                    ++*this;
+
+                    return ret;
+                }
+
+                bool    operator == (const iterator & other) const
+                {
+                    return this -> index == other.index;
+                }
+
+                bool    operator != (const iterator & other) const
+                {
+                    return this -> index != other.index;
+                }
+
+            private:
+                Stream *    stream;
+                size_t      index;
+        };
+
+        EXPORT  Stream  ( const Ellipse & ellipse
+                        , const float start
+                        , const float step
+                        , const size_t count
+                        , const Trig & trig
+                        );
+
+        /**
+         * \brief   Restart this stream.
+         * \return  An iterator to the first point.
+         */
+
+        iterator    begin   (void)
+        {
+            if (this -> count)
+                this -> refill (0x0);
+
+            return iterator (this, 0x0);
+        }
+
+        /**
+         * \brief   The end of this stream.
+         * \return  An iterator past the last point.
+         *
+         * Unbounded streams, whose count is `SIZE_MAX`, do not reach their end
+         * in practice.
+         */
+
+        iterator    end     (void)
+        {
+            return iterator (this, this -> count);
+        }
+
+        /**
+         * \brief   The count of points of this stream.
+         * \return  The count, or `SIZE_MAX` for an unbounded stream.
+         */
+
+        size_t      size    (void) const
+        {
+            return this -> count;
+        }
+
+#if __cplusplus >= 202002L && defined (__cpp_impl_coroutine)
+        /**
+         * \brief   A generator yielding the points of a stream.
+         *
+         * The generator owns the coroutine frame which holds a copy of the
+         * stream.  Hence, the frame is the only allocation, independently of
+         * the count of points.
+         */
+
+        class Generator
+        {
+            public:
+                struct promise_type
+                {
+                    Point   point;
+
+                    Generator   get_return_object   (void)
+                    {
+                        return Generator
+                            (handle :: from_promise (*this));
+                    }
+
+                    std :: suspend_always   initial_suspend (void) noexcept
+                    {
+                        return {};
+                    }
+
+                    std :: suspend_always   final_suspend   (void) noexcept
+                    {
+                        return {};
+                    }
+
+                    std :: suspend_always   yield_value (const Point & point)
+                        noexcept
+                    {
+                        this -> point = point;
+                        return {};
+                    }
+
+                    void    return_void (void) noexcept
+                    {
+                        return;
+                    }
+
+                    void    unhandled_exception (void)
+                    {
+                        throw;
+                    }
+                };
+
+                using handle = std :: coroutine_handle <promise_type>;
+
+                class iterator
+                {
+                    public:
+                        using difference_type   = ptrdiff_t;
+                        using value_type        = Point;
+
+                        iterator (void)
+                            : coroutine (nullptr)
+                        {
+                            return;
+                        }
+
+                        explicit iterator (const handle coroutine)
+                            : coroutine (coroutine)
+                        {
+                            return;
+                        }
+
+                        Point   operator *  (void) const
+                        {
+                            return this -> coroutine.promise ().point;
+                        }
+
+                        iterator &  operator ++ (void)
+                        {
+                            this -> coroutine.resume ();
+                            return *this;
+                        }
+
+                        void    operator ++ (int)
+                        {
+                            this -> coroutine.resume ();
+                            return;
+                        }
+
+                        bool    operator == (std :: default_sentinel_t) const
+                        {
+                            return this -> coroutine.done ();
+                        }
+
+                    private:
+                        handle  coroutine;
+                };
+
+                Generator (void)
+                    : coroutine (nullptr)
+                {
+                    return;
+                }
+
+                Generator (Generator && other) noexcept
+                    : coroutine (other.coroutine)
+                {
+                    other.coroutine = nullptr;
+                    return;
+                }
+
+                Generator & operator =  (Generator && other) noexcept
+                {
+                    if (this -> coroutine)
+                        this -> coroutine.destroy ();
+
+                    this -> coroutine   = other.coroutine;
+                    other.coroutine     = nullptr;
+
+                    return *this;
+                }
+
+                ~Generator (void)
+                {
+                    if (this -> coroutine)
+                        this -> coroutine.destroy ();
+
+                    return;
+                }
+
+                iterator    begin   (void)
+                {
+                    this -> coroutine.resume ();
+                    return iterator (this -> coroutine);
+                }
+
+                std :: default_sentinel_t   end (void) const
+                {
+                    return {};
+                }
+
+            private:
+                handle  coroutine;
+
+                explicit Generator (const handle coroutine)
+                    : coroutine (coroutine)
+                {
+                    return;
+                }
+        };
+
+        /**
+         * \brief   Yield the points of a stream by a coroutine.
+         * \param   stream  The stream to copy into the coroutine frame.
+         * \return  The generator.
+         *
+         * This function is defined in this header since the library itself
+         * might be compiled with an older standard.
+         */
+
+        static Generator    generate    (Stream stream)
+        {
+            for (const Point point : stream)
+                co_yield point;
+        }
+#endif  // ! __cpp_impl_coroutine
+
+    private:
+        static const size_t block   {0x40};
+        static const size_t mask    {block - 0x1};
+
+        const Ellipse * ellipse;
+        Trig            trig;
+        double          start;
+        double          step;
+        size_t          count;
+        float           x   [block];
+        float           y   [block];
+        float           z   [block];
+
+        EXPORT  void    refill  (const size_t first);
+};
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __STREAM_HPP__
+
+/******************************************************************************/
@@ -0,0 +1,317 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The cache of tessellated ellipse shapes.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Tessellation.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Tessellation` class.  Since the
+ * class is an auxiliary one, all of its methods are stored in this file.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Instrumentation.hpp"
+#include "Tessellation.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+
+/**
+ * \brief   Create an empty cache.
+ * \param   budget  The count of bytes the cached polylines may occupy.
+ *
+ * Each shard may occupy a sixteenth of the budget.
+ */
+
+ELLIPSE_INLINE Tessellation :: Tessellation (const size_t budget)
+    : budget    (budget)
+{
+    for (size_t i = 0x0; i < Tessellation :: shard_count; i++)
+    {
+        this -> shards[i].bytes     = 0x0;
+        this -> shards[i].hits      = 0x0;
+        this -> shards[i].misses    = 0x0;
+        this -> shards[i].evictions = 0x0;
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Destroy this cache.
+ *
+ * Polylines which are still referenced by callers stay valid.
+ */
+
+ELLIPSE_INLINE Tessellation :: ~Tessellation (void)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Hash a key.
+ * \param   key The key to hash.
+ * \return  The hash.
+ *
+ * The bit patterns of the three floats are combined and mixed by the
+ * finaliser of MurmurHash3 such that the shard index, being taken from the
+ * lower bits, depends on all of them.
+ */
+
+ELLIPSE_INLINE
+size_t Tessellation :: Hash :: operator () (const Key & key) const
+{
+    uint32_t    bits    [0x3]   {};
+
+    std :: memcpy (bits, & key, sizeof (bits));
+
+    uint64_t    ret
+        { (uint64_t (bits[0x0]) << 0x20 | bits[0x1])
+        ^ uint64_t (bits[0x2]) * 0x9e3779b97f4a7c15
+        };
+
+    ret ^= ret >> 0x21;
+    ret *= 0xff51afd7ed558ccd;
+    ret ^= ret >> 0x21;
+    ret *= 0xc4ceb9fe1a85ec53;
+    ret ^= ret >> 0x21;
+
+    return size_t (ret);
+}
+
+
+
+/**
+ * \brief   Tessellate the shape of an ellipse.
+ * \param   major       The semi-axis along the first coordinate.
+ * \param   minor       The semi-axis along the second coordinate.
+ * \param   tolerance   The maximal deviation of the polyline from the curve.
+ * \return  The vertices of the closed polyline within the local frame.
+ *
+ * The vertices are equidistant in the parameter and computed in double
+ * precision.  A segment spanning the parameter step `h` has a sagitta of about
+ * `k s^2 / 8` with the curvature `k` and the arc length `s = |r'| h`.  Since
+ * `k |r'|^2 = a b / |r'|` never exceeds the greater semi-axis `a`, the step
+ * `sqrt (8 tolerance / a)` bounds the sagitta of every segment by `tolerance`.
+ * The count of vertices is capped at 65536, in which case the achieved bound
+ * `a h^2 / 8` is greater than `tolerance`; it is reported in `deviation`.  In
+ * case one of the semi-axes vanishes or the tolerance is not positive, an
+ * empty polyline is returned.
+ */
+
+ELLIPSE_INLINE Tessellation :: Polyline Tessellation :: canonical
+    ( const float major
+    , const float minor
+    , const float tolerance
+    )
+{
+    Polyline    ret {};
+
+    const double    a   {std :: max (std :: abs (major), std :: abs (minor))};
+    const double    b   {std :: min (std :: abs (major), std :: abs (minor))};
+
+    if (! (b > 0.) || ! (tolerance > 0.f) || std :: isinf (a))
+        return ret;
+
+    const double    step    {std :: sqrt (8. * tolerance / a)};
+    const size_t    count
+        {size_t (std :: min (std :: max (std :: ceil (6.283185307 / step), 16.)
+                            , 65536.
+                            ))
+        };
+    const double    h       {6.283185307179586 / double (count)};
+
+    ELLIPSE_ALLOCATE (0x2 * count * sizeof (float));
+
+    ret.u.resize (count);
+    ret.v.resize (count);
+    ret.deviation   = float (a * h * h / 8.);
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const double    t   {6.283185307179586 * double (i) / double (count)};
+
+        ret.u[i]    = float (major * std :: cos (t));
+        ret.v[i]    = float (minor * std :: sin (t));
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Remove all entries and reset the statistics.
+ *
+ * Polylines which are still referenced by callers stay valid.
+ */
+
+ELLIPSE_INLINE void Tessellation :: clear (void)
+{
+    for (size_t i = 0x0; i < Tessellation :: shard_count; i++)
+    {
+        Shard &                             shard   {this -> shards[i]};
+        std :: lock_guard <std :: mutex>    lock    (shard.mutex);
+
+        shard.index.clear ();
+        shard.entries.clear ();
+
+        shard.bytes     = 0x0;
+        shard.hits      = 0x0;
+        shard.misses    = 0x0;
+        shard.evictions = 0x0;
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Look up the canonical polyline of a shape.
+ * \param   major       The semi-axis along the first coordinate.
+ * \param   minor       The semi-axis along the second coordinate.
+ * \param   tolerance   The maximal deviation of the polyline from the curve.
+ * \return  The canonical polyline.
+ *
+ * On a hit, the entry becomes the most recently used one of its shard.  On a
+ * miss, the polyline is computed by `canonical` without holding the lock of
+ * the shard and inserted afterwards, unless another thread inserted it
+ * meanwhile.  Then, the least recently used entries are evicted until the
+ * shard fits into its share of the budget again.  A polyline which exceeds the
+ * share on its own is returned without being cached.
+ */
+
+ELLIPSE_INLINE std :: shared_ptr <const Tessellation :: Polyline>
+Tessellation :: lookup  ( const float major
+                        , const float minor
+                        , const float tolerance
+                        )
+{
+    ELLIPSE_COUNT ("Tessellation :: lookup");
+
+    const Key       key     {major + 0.f, minor + 0.f, tolerance + 0.f};
+    Shard &         shard
+        {this -> shards[Hash () (key) % Tessellation :: shard_count]};
+
+    {
+        std :: lock_guard <std :: mutex>    lock    (shard.mutex);
+
+        const auto  found   = shard.index.find (key);
+
+        if (found != shard.index.end ())
+        {
+            shard.hits++;
+            shard.entries.splice
+                (shard.entries.begin (), shard.entries, found -> second);
+
+            return found -> second -> polyline;
+        };
+
+        shard.misses++;
+    }
+
+    ELLIPSE_ALLOCATE (sizeof (Polyline));
+
+    const std :: shared_ptr <const Polyline>    polyline
+        {std :: make_shared <const Polyline>
+            (Tessellation :: canonical (major, minor, tolerance))
+        };
+
+    const size_t    share   {this -> budget / Tessellation :: shard_count};
+    const size_t    bytes
+        { sizeof (Entry)
+        + sizeof (Polyline)
+        + (polyline -> u.size () + polyline -> v.size ()) * sizeof (float)
+        };
+
+    if (bytes > share)
+        return polyline;
+
+    std :: lock_guard <std :: mutex>    lock    (shard.mutex);
+
+    const auto  found   = shard.index.find (key);
+
+    if (found != shard.index.end ())
+        return found -> second -> polyline;
+
+    shard.entries.push_front (Entry {key, polyline, bytes});
+    shard.index.emplace (key, shard.entries.begin ());
+    shard.bytes += bytes;
+
+    while (shard.bytes > share)
+    {
+        const Entry &   last    {shard.entries.back ()};
+
+        shard.bytes -= last.bytes;
+        shard.index.erase (last.key);
+        shard.entries.pop_back ();
+        shard.evictions++;
+    };
+
+    return polyline;
+}
+
+
+
+/**
+ * \brief   The usage of this cache.
+ * \return  The statistics summed over all shards.
+ *
+ * The shards are locked one after another such that the result is not an
+ * atomic snapshot while other threads use this cache.
+ */
+
+ELLIPSE_INLINE
+Tessellation :: Statistics Tessellation :: statistics (void) const
+{
+    Statistics  ret {0x0, 0x0, 0x0, 0x0, 0x0};
+
+    for (size_t i = 0x0; i < Tessellation :: shard_count; i++)
+    {
+        const Shard &                       shard   {this -> shards[i]};
+        std :: lock_guard <std :: mutex>    lock    (shard.mutex);
+
+        ret.hits        += shard.hits;
+        ret.misses      += shard.misses;
+        ret.evictions   += shard.evictions;
+        ret.bytes       += shard.bytes;
+        ret.entries     += shard.entries.size ();
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
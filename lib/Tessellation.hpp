@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Tessellation` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Tessellation.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the `Tessellation` class, a thread-safe cache of
+ * tessellated ellipse shapes.
+ *
+ * Scenes often contain many ellipses which only differ by their placement.  The
+ * cache stores one polyline per distinct shape such that tessellating another
+ * ellipse of the same shape reduces to a single affine pass over the cached
+ * vertices.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __TESSELLATION_HPP__
+#define __TESSELLATION_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "EXPORT.hpp"
+
+using std :: size_t;
+using std :: uint64_t;
+
+
+
+/**
+ * \brief   A cache of tessellated ellipse shapes.
+ *
+ * The shape of an ellipse only depends on its semi-axes, its placement in
+ * space on the centre, the tangent and the normal.  Hence, all ellipses with
+ * the same semi-axes share a canonical polyline within their local frame which
+ * only needs to be placed when emitting the vertices.  This cache stores the
+ * canonical polylines keyed by the semi-axes and the tolerance.
+ *
+ * The entries are distributed among 16 shards by the hash of their keys, each
+ * of which is guarded by its own mutex and evicts its least recently used
+ * entries when exceeding its share of the memory budget.  Polylines are handed
+ * out as shared pointers such that they can be placed without holding a lock
+ * and stay valid when they are evicted meanwhile.
+ */
+
+class Tessellation
+{
+    public:
+        /**
+         * \brief   A canonical polyline within the local frame of an ellipse.
+         *
+         * The first coordinate runs along the major axis, the second one along
+         * the minor axis.  The polyline is closed implicitly.  The deviation
+         * is an upper bound of the distance of the polyline from the curve; it
+         * exceeds the requested tolerance when the count of vertices is capped.
+         */
+
+        struct Polyline
+        {
+            std :: vector <float>   u;
+            std :: vector <float>   v;
+            float                   deviation;
+        };
+
+        /**
+         * \brief   The usage of a cache.
+         *
+         * The counters are accumulated since the creation of the cache or the
+         * last call to `clear`.  `bytes` and `entries` describe the current
+         * contents.
+         */
+
+        struct Statistics
+        {
+            uint64_t    hits;
+            uint64_t    misses;
+            uint64_t    evictions;
+            size_t      bytes;
+            size_t      entries;
+        };
+
+        EXPORT  explicit    Tessellation    (const size_t budget);
+        EXPORT              ~Tessellation   (void);
+
+        Tessellation (const Tessellation & other)                   = delete;
+        Tessellation & operator =   (const Tessellation & other)    = delete;
+
+        EXPORT  static  Polyline    canonical   ( const float major
+                                                , const float minor
+                                                , const float tolerance
+                                                );
+
+        EXPORT  void        clear       (void);
+        EXPORT  Statistics  statistics  (void) const;
+
+        EXPORT  std :: shared_ptr <const Polyline>  lookup
+            ( const float major
+            , const float minor
+            , const float tolerance
+            );
+
+    private:
+        /**
+         * \brief   The key of an entry.
+         *
+         * The key is compared bitwise such that the same parameters always hit
+         * the same entry.  Its fields are normalised by adding zero such that
+         * `-0.f` and `0.f` share an entry.
+         */
+
+        struct Key
+        {
+            float   major;
+            float   minor;
+            float   tolerance;
+
+            bool operator == (const Key & other) const
+            {
+                return ! std :: memcmp (this, & other, sizeof (Key));
+            }
+        };
+
+        /**
+         * \brief   The hash of a key.
+         */
+
+        struct Hash
+        {
+            EXPORT  size_t  operator () (const Key & key) const;
+        };
+
+        /**
+         * \brief   A cached polyline together with its key and size.
+         */
+
+        struct Entry
+        {
+            Key                                 key;
+            std :: shared_ptr <const Polyline>  polyline;
+            size_t                              bytes;
+        };
+
+        /**
+         * \brief   An independent part of the cache.
+         *
+         * The entries are ordered from the most to the least recently used one.
+         * The map points into this list.
+         */
+
+        struct Shard
+        {
+            mutable std :: mutex            mutex;
+            std :: list <Entry>             entries;
+            std :: unordered_map
+                < Key
+                , std :: list <Entry> :: iterator
+                , Hash
+                >                           index;
+            size_t                          bytes;
+            uint64_t                        hits;
+            uint64_t                        misses;
+            uint64_t                        evictions;
+        };
+
+        static  const   size_t  shard_count {0x10};
+
+        Shard   shards  [shard_count];
+        size_t  budget;
+};
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __TESSELLATION_HPP__
+
+/******************************************************************************/
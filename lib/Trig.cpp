@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The selectable backends for sines and cosines.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Trig.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the methods of the `Trig` class.  Since the class is
+ * an auxiliary one, all of its methods are stored in this file.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Trig.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+using std :: uint32_t;
+
+
+
+/**
+ * \brief   The maximal absolute error of the selected backend.
+ * \return  The bound for both the sine and the cosine.
+ *
+ * The bounds of the `polynomial` and the `table` backend were determined by
+ * evaluating all single precision arguments with `|t| <= 4096` against a
+ * double precision reference.  They only hold within this range since the
+ * argument reduction splits the quarter period into three constants whose
+ * products with the count of quarter periods are only exact for small counts.
+ * Larger arguments should be reduced by the caller.
+ *
+ * The bound of the `libm` backend is the documented accuracy of the GNU C
+ * library, one unit in the last place for values of at most one.
+ */
+
+ELLIPSE_INLINE float Trig :: bound (void) const
+{
+    switch (this -> backend)
+    {
+        case Trig :: polynomial:
+            return this -> degree == 0x3 ? 1.6e-4f
+                 : this -> degree == 0x5 ? 6.5e-7f
+                 : 1.9e-7f;
+
+        case Trig :: table:
+            return 1.3e-7f;
+
+        default:
+            return 6e-8f;
+    };
+}
+
+
+
+/**
+ * \brief   Compute the sine and the cosine of a single value.
+ * \param   t       The argument.
+ * \param   sine    The sine of `t`.
+ * \param   cosine  The cosine of `t`.
+ */
+
+ELLIPSE_INLINE void Trig :: sincos  ( const float t
+                                    , float & sine
+                                    , float & cosine
+                                    ) const
+{
+    this -> sincos (& t, 0x1, & sine, & cosine);
+    return;
+}
+
+
+
+/**
+ * \brief   Approximate the sines and the cosines of a batch of values.
+ * \param   t       The arguments.
+ * \param   count   The count of arguments.
+ * \param   sine    The sines of the arguments.
+ * \param   cosine  The cosines of the arguments.
+ *
+ * Both the `polynomial` and the `table` backend reduce the argument by
+ * multiples of a quarter period at first.  The count of quarter periods is
+ * rounded by adding and subtracting `1.5 * 2^23` which avoids a branch.  The
+ * remainder `r` lies within `[-pi / 4, pi / 4]`.
+ *
+ * The `polynomial` backend approximates the sine and the cosine of `r` by
+ * minimax polynomials.  The quadrant then selects and negates the results,
+ * accordingly.  The signs are flipped directly in the bit patterns since this
+ * requires fewer instructions than a further selection.
+ *
+ * The `table` backend reduces `r` by multiples of 1 / 256 of a period such that
+ * the final remainder `e` satisfies `|e| <= pi / 256`.  The tabulated sine and
+ * cosine of the multiple are combined with `sin (e) ~ e - e^3 / 6` and
+ * `cos (e) ~ 1 - e^2 / 2` by the addition theorems.
+ */
+
+ELLIPSE_INLINE void Trig :: approximate ( const float * t
+                                        , const size_t count
+                                        , float * sine
+                                        , float * cosine
+                                        ) const
+{
+    const auto  reduce  = [] (const float t, int & k) -> float
+    {
+        const float q   {(t * 0.63661975f + 12582912.f) - 12582912.f};
+
+        k = int (q);
+
+        return ((t - q * 1.5703125f) - q * 4.8375130e-4f) - q * 7.5497901e-8f;
+    };
+
+    const auto  negate  = [] (const float value, const int bit) -> float
+    {
+        float       ret     {0.f};
+        uint32_t    bits    {0x0};
+
+        std :: memcpy (& bits, & value, sizeof (bits));
+        bits ^= uint32_t (bit) << 0x1e;
+        std :: memcpy (& ret, & bits, sizeof (ret));
+
+        return ret;
+    };
+
+    const auto  rotate  = [negate] ( const int k
+                                   , const float s
+                                   , const float c
+                                   , float & sine
+                                   , float & cosine
+                                   ) -> void
+    {
+        const float u   {k & 0x1 ? c : s};
+        const float v   {k & 0x1 ? s : c};
+
+        sine    = negate (u, k & 0x2);
+        cosine  = negate (v, (k + 0x1) & 0x2);
+
+        return;
+    };
+
+    switch (this -> backend)
+    {
+        case Trig :: polynomial:
+            if (this -> degree == 0x3)
+            {
+#pragma omp simd
+                for (size_t i = 0x0; i < count; i++)
+                {
+                    int         k   {0x0};
+                    const float r   {reduce (t[i], k)};
+                    const float r2  {r * r};
+                    const float s
+                        {r * (0.99903152f + r2 * -0.16034433f)};
+                    const float c
+                        { 0.99999004f
+                        + r2 * (-0.49970817f + r2 * 0.040398599f)
+                        };
+
+                    rotate (k, s, c, sine[i], cosine[i]);
+                };
+            }
+            else if (this -> degree == 0x5)
+            {
+#pragma omp simd
+                for (size_t i = 0x0; i < count; i++)
+                {
+                    int         k   {0x0};
+                    const float r   {reduce (t[i], k)};
+                    const float r2  {r * r};
+                    const float s
+                        { r
+                        * ( 0.99999500f
+                          + r2 * (-0.16660163f + r2 * 0.0081215684f)
+                          )
+                        };
+                    const float c
+                        { 0.99999997f
+                        + r2
+                        * ( -0.49999857f
+                          + r2 * (0.041655028f + r2 * -0.0013585924f)
+                          )
+                        };
+
+                    rotate (k, s, c, sine[i], cosine[i]);
+                };
+            }
+            else
+            {
+#pragma omp simd
+                for (size_t i = 0x0; i < count; i++)
+                {
+                    int         k   {0x0};
+                    const float r   {reduce (t[i], k)};
+                    const float r2  {r * r};
+                    const float s
+                        { r
+                        + r * r2
+                        * ( -0.16666664f
+                          + r2 * (0.0083315848f + r2 * -1.9462136e-4f)
+                          )
+                        };
+                    const float c
+                        { 1.f
+                        + r2
+                        * ( -0.5f
+                          + r2
+                          * ( 0.041666617f
+                            + r2 * (-0.0013886619f + r2 * 2.4379950e-5f)
+                            )
+                          )
+                        };
+
+                    rotate (k, s, c, sine[i], cosine[i]);
+                };
+            };
+
+            break;
+
+        case Trig :: table:
+        {
+            const float * const values  {Trig :: values ()};
+
+#pragma omp simd
+            for (size_t i = 0x0; i < count; i++)
+            {
+                int         k   {0x0};
+                const float r   {reduce (t[i], k)};
+                const float q   {(r * 40.743664f + 12582912.f) - 12582912.f};
+                const float e
+                    { ((r - q * 0.0245361328125f) - q * 7.5586140e-6f)
+                    - q * 1.1796547e-9f
+                    };
+                const float e2  {e * e};
+                const float s   {e * (1.f - e2 * 0.16666667f)};
+                const float c   {1.f - e2 * 0.5f};
+                const int   j   {(k * 0x40 + int (q)) & 0xff};
+                const float vs  {values[j]};
+                const float vc  {values[(j + 0x40) & 0xff]};
+
+                sine[i]     = vs * c + vc * s;
+                cosine[i]   = vc * c - vs * s;
+            };
+
+            break;
+        }
+
+        default:
+            break;
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   The table of the `table` backend.
+ * \return  The sines of 256 equidistant values within one period.
+ *
+ * The table is computed in double precision on the first call.  The cosines
+ * are obtained from the same table shifted by a quarter period.
+ */
+
+ELLIPSE_INLINE const float * Trig :: values (void)
+{
+    struct Table
+    {
+        float   values  [0x100];
+
+        Table (void)
+        {
+            for (int k = 0x0; k < 0x100; k++)
+                this -> values[k]
+                    = float (std :: sin (0.02454369260617026 * double (k)));
+
+            return;
+        }
+    };
+
+    static const Table  ret {};
+
+    return ret.values;
+}
+
+/******************************************************************************/
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Introducing the `Trig` class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        Trig.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header introduces the `Trig` class which selects how sines and cosines
+ * are computed by the batch kernels of the `Ellipse` class.
+ *
+ * Consumers which only need a limited accuracy, for instance for rendering, do
+ * not need to pay for the full precision of the C standard library.  Hence,
+ * they may choose a cheaper backend per call.  Each backend reports an upper
+ * bound of its absolute error such that the choice can be made by the required
+ * accuracy.  Furthermore, an arctangent is provided which can be inlined into
+ * SIMD loops.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __TRIG_HPP__
+#define __TRIG_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <cmath>
+#include <cstddef>
+
+#include "EXPORT.hpp"
+
+using std :: size_t;
+
+
+
+/**
+ * \brief   A selectable backend for sines and cosines.
+ *
+ * The default backend is the C standard library.  Alternatively, a minimax
+ * polynomial of a chosen degree or a table with a short polynomial can be
+ * used.  The latter two are evaluated in SIMD lanes.
+ *
+ * This class is a plain value type.  It neither allocates memory nor holds any
+ * further state besides the selection.
+ */
+
+class Trig
+{
+    public:
+        /**
+         * \brief   The available backends.
+         *
+         * `libm` calls `std :: sin` and `std :: cos` for each value.
+         * `polynomial` reduces the argument to a quarter period and evaluates
+         * minimax polynomials of the chosen degree.  `table` reduces the
+         * argument to 1 / 256 of a period and corrects the tabulated values by
+         * a polynomial of degree three.
+         */
+
+        enum Backend
+        {
+            libm,
+            polynomial,
+            table
+        };
+
+        /**
+         * \brief   The default constructor.
+         *
+         * The default backend is the C standard library.  The constructors are
+         * defined in this header such that the backend of a temporary is known
+         * at the call site.
+         */
+
+        Trig (void)
+            : backend   (Trig :: libm)
+            , degree    (0x0)
+        {
+            return;
+        }
+
+        /**
+         * \brief   Select a certain backend.
+         * \param   backend The backend to use.
+         * \param   degree  The degree of the sine polynomial, 3, 5 or 7.
+         *
+         * The degree is only considered by the `polynomial` backend.  The
+         * cosine polynomial is always one degree higher than the sine
+         * polynomial.  Other degrees are rounded up to the next supported one,
+         * degrees greater than seven are reduced to seven since this already
+         * reaches the precision of `float`.
+         */
+
+        Trig (const Backend backend, const unsigned int degree)
+            : backend   (backend)
+            , degree    (degree <= 0x3 ? 0x3 : degree <= 0x5 ? 0x5 : 0x7)
+        {
+            return;
+        }
+
+        EXPORT  float   bound   (void) const;
+        EXPORT  void    sincos  ( const float t
+                                , float & sine
+                                , float & cosine
+                                ) const;
+
+        /**
+         * \brief   Compute the angle of a vector.
+         * \param   y   The y coordinate of the vector.
+         * \param   x   The x coordinate of the vector.
+         * \return  The angle within `[-pi, pi]`, like `std :: atan2`.
+         *
+         * The ratio of the smaller and the greater coordinate is reduced to at
+         * most `tan (pi / 8)` and the arctangent is approximated by a minimax
+         * polynomial by Moshier.  The octant then mirrors the result.  The
+         * absolute error is less than 3e-7, hence, one unit in the last place
+         * of `pi`.  Since there are no branches, this function is defined in
+         * this header such that it can be inlined into the SIMD loops of the
+         * kernels of other translation units.  The zero vector has the angle
+         * zero.
+         */
+
+        static float angle (const float y, const float x)
+        {
+            const float ax      {std :: abs (x)};
+            const float ay      {std :: abs (y)};
+            const float high    {ax > ay ? ax : ay};
+            const float low     {ax > ay ? ay : ax};
+            const float q       {high > 0.f ? low / high : 0.f};
+            const bool  half    {q > 0.414213562f};
+            const float r       {half ? (q - 1.f) / (q + 1.f) : q};
+            const float z       {r * r};
+            float       ret
+                { ((( 8.05374449538e-2f  * z
+                    - 1.38776856032e-1f) * z
+                    + 1.99777106478e-1f) * z
+                    - 3.33329491539e-1f) * z * r
+                + r
+                };
+
+            ret = half ? ret + 0.785398163f : ret;
+            ret = ay > ax ? 1.57079633f - ret : ret;
+            ret = x < 0.f ? 3.14159265f - ret : ret;
+
+            return y < 0.f ? - ret : ret;
+        }
+
+        /**
+         * \brief   Compute the sines and the cosines of a batch of values.
+         * \param   t       The arguments.
+         * \param   count   The count of arguments.
+         * \param   sine    The sines of the arguments.
+         * \param   cosine  The cosines of the arguments.
+         *
+         * The backend is dispatched once per batch.  The `libm` backend is
+         * defined in this header such that it can be inlined into the kernels
+         * of other translation units.  Otherwise, single values would pay for
+         * a further call in addition to the ones of the C standard library.
+         */
+
+        void    sincos  ( const float * t
+                        , const size_t count
+                        , float * sine
+                        , float * cosine
+                        ) const
+        {
+            if (this -> backend != Trig :: libm)
+            {
+                this -> approximate (t, count, sine, cosine);
+                return;
+            };
+
+            for (size_t i = 0x0; i < count; i++)
+            {
+                const float v   {t[i]};
+
+                sine[i]     = std :: sin (v);
+                cosine[i]   = std :: cos (v);
+            };
+
+            return;
+        }
+
+    private:
+        Backend         backend;
+        unsigned int    degree;
+
+        EXPORT  void    approximate ( const float * t
+                                    , const size_t count
+                                    , float * sine
+                                    , float * cosine
+                                    ) const;
+
+        EXPORT  static  const float *   values  (void);
+};
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __TRIG_HPP__
+
+/******************************************************************************/
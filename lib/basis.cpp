@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Determine the orthonormal basis of an ellipse's plane.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        basis.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The parametrisation of an ellipse refers to its local frame whose first axis
+ * is the major axis and whose second one is the minor axis.  In order to place
+ * the ellipse in space, the frame needs to be expressed by the tangent and the
+ * normal which are not required to be unit vectors or orthogonal to each other.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Determine the orthonormal basis of an ellipse's plane.
+ * \param   tangent The tangent of the ellipse.
+ * \param   normal  The normal of the ellipse.
+ * \param   u       The unit vector along the major axis.
+ * \param   v       The unit vector along the minor axis.
+ *
+ * The normal is normalised, falling back to the z axis in case it vanishes.
+ * The major axis is the tangent, made orthogonal to the normal by the
+ * Gram-Schmidt process.  In case the tangent vanishes or is parallel to the
+ * normal, the x axis and then the y axis are tried instead.  Finally, the
+ * minor axis completes the right-handed frame as the cross product of the
+ * normal and the major axis.
+ *
+ * Hence, an ellipse with the tangent `(tx, ty, 0)` and the normal `(0, 0, 1)`
+ * lies within the x-y plane, rotated by the tangent's angle to the x axis.
+ */
+
+ELLIPSE_INLINE void Ellipse :: basis  ( const float * tangent
+                                      , const float * normal
+                                      , double (& u) [0x3]
+                                      , double (& v) [0x3]
+                                      )
+{
+    double  n       [0x3]   {normal[0x0], normal[0x1], normal[0x2]};
+    double  length
+        {sqrt (n[0x0] * n[0x0] + n[0x1] * n[0x1] + n[0x2] * n[0x2])};
+
+    if (length > 0.)
+        for (size_t i = 0x0; i < 0x3; i++)
+            n[i] /= length;
+    else
+    {
+        n[0x0]  = 0.;
+        n[0x1]  = 0.;
+        n[0x2]  = 1.;
+    };
+
+    const double    candidates  [0x3][0x3]
+        { {tangent[0x0], tangent[0x1], tangent[0x2]}
+        , {1., 0., 0.}
+        , {0., 1., 0.}
+        };
+
+    for (size_t k = 0x0; k < 0x3; k++)
+    {
+        const double    dot
+            { candidates[k][0x0] * n[0x0]
+            + candidates[k][0x1] * n[0x1]
+            + candidates[k][0x2] * n[0x2]
+            };
+
+        for (size_t i = 0x0; i < 0x3; i++)
+            u[i] = candidates[k][i] - dot * n[i];
+
+        length = sqrt (u[0x0] * u[0x0] + u[0x1] * u[0x1] + u[0x2] * u[0x2]);
+
+        if (length > 1e-6)
+            break;
+    };
+
+    for (size_t i = 0x0; i < 0x3; i++)
+        u[i] /= length;
+
+    v[0x0]  = n[0x1] * u[0x2] - n[0x2] * u[0x1];
+    v[0x1]  = n[0x2] * u[0x0] - n[0x0] * u[0x2];
+    v[0x2]  = n[0x0] * u[0x1] - n[0x1] * u[0x0];
+
+    return;
+}
+
+
+
+/**
+ * \brief   Determine the orthonormal basis of this ellipse's plane.
+ * \param   u       The unit vector along the major axis.
+ * \param   v       The unit vector along the minor axis.
+ *
+ * In case the derived data of this ellipse is valid, the stored basis is
+ * copied.  Otherwise, it is computed from the tangent and the normal.
+ */
+
+ELLIPSE_INLINE
+void Ellipse :: basis (double (& u) [0x3], double (& v) [0x3]) const
+{
+    if (! this -> cache ())
+    {
+        Ellipse :: basis    ( this -> tangent.data ()
+                            , this -> normal.data ()
+                            , u
+                            , v
+                            );
+        return;
+    };
+
+    for (size_t i = 0x0; i < 0x3; i++)
+    {
+        u[i]    = this -> derived.u[i];
+        v[i]    = this -> derived.v[i];
+    };
+
+    return;
+}
+
+/******************************************************************************/
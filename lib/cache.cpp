@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Check the derived data of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        cache.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The queries which are able to use the derived data ask this method whether it
+ * is valid.  In `deferred` mode, outdated data is recomputed first.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Whether the derived data of this ellipse can be used.
+ * \return  `true`, if the derived data is valid.
+ *
+ * In case the derived data is outdated and this ellipse is in `deferred` mode,
+ * it is recomputed by `refresh`.  Hence, a burst of setter calls only causes a
+ * single recomputation at the first query afterwards.
+ *
+ * Since this writes to the ellipse, a `deferred` ellipse with outdated data
+ * must not be queried by multiple threads at once.
+ */
+
+ELLIPSE_INLINE bool Ellipse :: cache (void) const
+{
+    if (! this -> cached && this -> caching == Ellipse :: deferred)
+        this -> refresh ();
+
+    return this -> cached;
+}
+
+/******************************************************************************/
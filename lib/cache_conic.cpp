@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Cache the implicit form of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        cache_conic.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Algorithms which query the implicit form of the same ellipse repeatedly can
+ * request it to be cached.  The cache is discarded by all setters which change
+ * the geometry.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Cache the implicit form of this ellipse.
+ *
+ * Afterwards, `get_conic` returns the stored conic until the geometry is
+ * changed by one of the setters.  Since the conic is part of the derived data
+ * of this ellipse, this is the same as `refresh`.
+ */
+
+ELLIPSE_INLINE void Ellipse :: cache_conic (void)
+{
+    ELLIPSE_COUNT ("cache_conic");
+
+    this -> refresh ();
+
+    return;
+}
+
+/******************************************************************************/
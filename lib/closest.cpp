@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Determine the closest curve point to a given point.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        closest.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This is a private member function which is required by algorithms which need
+ * the exact distance of a point to the ellipse, for instance the trimming of
+ * offset curves.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+
+
+
+/**
+ * \brief   Determine the closest curve point to a given point.
+ * \param   x   The x coordinate of the point within the ellipse's plane.
+ * \param   y   The y coordinate of the point within the ellipse's plane.
+ * \param   t   The parameter value of the closest curve point.
+ * \return  The distance between the point and the ellipse.
+ *
+ * The closest point is determined by the robust method of David Eberly.  Due
+ * to the symmetry of the ellipse, the point is reflected into the first
+ * quadrant.  There, the closest point is given by the unique root of a
+ * monotonic function which is found by bisection.  Thus, the result is exact
+ * up to the precision of a `double`, even for points close to the centre where
+ * Newton's method tends to diverge.
+ */
+
+ELLIPSE_INLINE
+float Ellipse :: closest (const float x, const float y, float & t) const
+{
+    const bool      swap    {this -> minor > this -> major};
+    const double    e0      {swap ? this -> minor : this -> major};
+    const double    e1      {swap ? this -> major : this -> minor};
+    const double    y0      {abs (double (swap ? y : x))};
+    const double    y1      {abs (double (swap ? x : y))};
+
+    double  x0  {0.};
+    double  x1  {0.};
+
+    if (e1 <= 0.)
+    {
+        x0  = std :: min (y0, e0);
+        x1  = 0.;
+    }
+    else if (y1 > 0.)
+    {
+        if (y0 > 0.)
+        {
+            const double    z0  {y0 / e0};
+            const double    z1  {y1 / e1};
+            const double    g   {z0 * z0 + z1 * z1 - 1.};
+            const double    r0  {(e0 / e1) * (e0 / e1)};
+            const double    n0  {r0 * z0};
+
+            double  s0  {z1 - 1.};
+            double  s1  {g < 0. ? 0. : sqrt (n0 * n0 + z1 * z1) - 1.};
+            double  s   {0.};
+
+            for (size_t i = 0x0; i < 0x60 && g != 0.; i++)
+            {
+                s = 0.5 * (s0 + s1);
+
+                if (s == s0 || s == s1)
+                    break;
+
+                const double    q0  {n0 / (s + r0)};
+                const double    q1  {z1 / (s + 1.)};
+                const double    f   {q0 * q0 + q1 * q1 - 1.};
+
+                if (f > 0.)
+                    s0 = s;
+                else if (f < 0.)
+                    s1 = s;
+                else
+                    break;
+            };
+
+            x0  = r0 * y0 / (s + r0);
+            x1  = y1 / (s + 1.);
+        }
+        else
+        {
+            x0  = 0.;
+            x1  = e1;
+        };
+    }
+    else
+    {
+        const double    numerator   {e0 * y0};
+        const double    denominator {e0 * e0 - e1 * e1};
+
+        if (numerator < denominator)
+        {
+            const double    ratio   {numerator / denominator};
+
+            x0  = e0 * ratio;
+            x1  = e1 * sqrt (1. - ratio * ratio);
+        }
+        else
+        {
+            x0  = e0;
+            x1  = 0.;
+        };
+    };
+
+    const double    px  {(swap ? y : x) < 0.f ? - x0 : x0};
+    const double    py  {(swap ? x : y) < 0.f ? - x1 : x1};
+    const double    cx  {swap ? py : px};
+    const double    cy  {swap ? px : py};
+
+    t = float (std :: atan2 ( this -> minor > 0.f ? cy / this -> minor : 0.
+                            , this -> major > 0.f ? cx / this -> major : 1.
+                            ));
+
+    return float (sqrt ((cx - x) * (cx - x) + (cy - y) * (cy - y)));
+}
+
+/******************************************************************************/
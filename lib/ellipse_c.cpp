@@ -0,0 +1,722 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The C interface of the library.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        ellipse_c.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This source file defines the functions of the C interface.  Since they only
+ * forward to the methods of the `Ellipse` class, all of them are stored in this
+ * file.
+ *
+ * No exception must leave a function of the C interface.  Hence, the few
+ * functions which might allocate memory or start threads catch any exception
+ * and report it by their status code.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+#include "ellipse_c.h"
+
+
+
+/**
+ * \brief   Address a certain element of a strided input array.
+ * \param   array   The array.
+ * \param   index   The index of the element.
+ * \return  A pointer to the element.
+ */
+
+static const float * ellipse_c_at   ( const ellipse_input_t & array
+                                    , const size_t index
+                                    )
+{
+    return reinterpret_cast <const float *>
+        ( reinterpret_cast <const char *> (array.data)
+        + ptrdiff_t (index) * array.stride
+        );
+}
+
+
+
+/**
+ * \brief   Address a certain element of a strided output array.
+ * \param   array   The array.
+ * \param   index   The index of the element.
+ * \return  A pointer to the element.
+ */
+
+static float * ellipse_c_at (const ellipse_output_t & array, const size_t index)
+{
+    return reinterpret_cast <float *>
+        ( reinterpret_cast <char *> (array.data)
+        + ptrdiff_t (index) * array.stride
+        );
+}
+
+
+
+/**
+ * \brief   Run a batch kernel on strided arrays.
+ * \param   inputs  The input arrays.
+ * \param   count   The count of elements.
+ * \param   outputs The output arrays.
+ * \param   kernel  The batch kernel, called with contiguous arrays.
+ * \return  The status code.
+ *
+ * In case all arrays are contiguous, the kernel is called once on the arrays
+ * themselves.  Otherwise, the arrays are processed in blocks of 256 elements.
+ * Only the strided arrays are gathered into and scattered from buffers on the
+ * stack.  The contiguous ones are still passed directly.
+ */
+
+template <size_t I, size_t O, typename Kernel>
+static ellipse_status_t ellipse_c_run   ( const ellipse_input_t (& inputs) [I]
+                                        , const size_t count
+                                        , const ellipse_output_t (& outputs) [O]
+                                        , const Kernel & kernel
+                                        )
+{
+    bool    contiguous  {true};
+
+    for (size_t k = 0x0; k < I; k++)
+    {
+        if (count && ! inputs[k].data)
+            return ELLIPSE_EARGUMENT;
+
+        contiguous = contiguous && inputs[k].stride == sizeof (float);
+    };
+
+    for (size_t k = 0x0; k < O; k++)
+    {
+        if (count && ! outputs[k].data)
+            return ELLIPSE_EARGUMENT;
+
+        contiguous = contiguous && outputs[k].stride == sizeof (float);
+    };
+
+    if (contiguous)
+    {
+        const float *   source  [I];
+        float *         target  [O];
+
+        for (size_t k = 0x0; k < I; k++)
+            source[k] = inputs[k].data;
+
+        for (size_t k = 0x0; k < O; k++)
+            target[k] = outputs[k].data;
+
+        kernel (source, count, target);
+
+        return ELLIPSE_OK;
+    };
+
+    const size_t    block   {0x100};
+
+    float   gathered    [I][block];
+    float   scattered   [O][block];
+
+    for (size_t begin = 0x0; begin < count; begin += block)
+    {
+        const size_t    size    {count - begin < block ? count - begin : block};
+        const float *   source  [I];
+        float *         target  [O];
+
+        for (size_t k = 0x0; k < I; k++)
+            if (inputs[k].stride == sizeof (float))
+                source[k] = inputs[k].data + begin;
+            else
+            {
+                for (size_t i = 0x0; i < size; i++)
+                    gathered[k][i] = *ellipse_c_at (inputs[k], begin + i);
+
+                source[k] = gathered[k];
+            };
+
+        for (size_t k = 0x0; k < O; k++)
+            target[k] = outputs[k].stride == sizeof (float)
+                      ? outputs[k].data + begin
+                      : scattered[k];
+
+        kernel (source, size, target);
+
+        for (size_t k = 0x0; k < O; k++)
+            if (outputs[k].stride != sizeof (float))
+                for (size_t i = 0x0; i < size; i++)
+                    *ellipse_c_at (outputs[k], begin + i) = scattered[k][i];
+    };
+
+    return ELLIPSE_OK;
+}
+
+
+
+/**
+ * \brief   Run a sampling kernel on strided arrays.
+ * \param   outputs The output arrays.
+ * \param   count   The count of points.
+ * \param   kernel  The sampling kernel, called with contiguous arrays.
+ * \return  The status code.
+ *
+ * The sampling kernels derive each point from its index.  Hence, they cannot
+ * be called in blocks and strided outputs are written by a temporary copy.  As
+ * the kernels might start threads, any exception is caught.
+ */
+
+template <typename Kernel>
+static ellipse_status_t ellipse_c_sample
+                                    ( const ellipse_output_t (& outputs) [0x3]
+                                    , const size_t count
+                                    , const Kernel & kernel
+                                    )
+{
+    bool    contiguous  {true};
+
+    for (size_t k = 0x0; k < 0x3; k++)
+    {
+        if (count && ! outputs[k].data)
+            return ELLIPSE_EARGUMENT;
+
+        contiguous = contiguous && outputs[k].stride == sizeof (float);
+    };
+
+    try
+    {
+        float * target  [0x3]   { outputs[0x0].data
+                                , outputs[0x1].data
+                                , outputs[0x2].data
+                                };
+
+        if (contiguous)
+        {
+            kernel (target);
+            return ELLIPSE_OK;
+        };
+
+        ELLIPSE_ALLOCATE (0x3 * count * sizeof (float));
+
+        vector <float>  buffer  (0x3 * count);
+
+        for (size_t k = 0x0; k < 0x3; k++)
+            target[k] = buffer.data () + k * count;
+
+        kernel (target);
+
+        for (size_t k = 0x0; k < 0x3; k++)
+            for (size_t i = 0x0; i < count; i++)
+                *ellipse_c_at (outputs[k], i) = target[k][i];
+
+        return ELLIPSE_OK;
+    }
+    catch (...)
+    {
+        return ELLIPSE_ERESOURCE;
+    };
+}
+
+
+
+/**
+ * \brief   Select the trigonometric backend of a batch function.
+ * \param   trig    The requested backend.
+ * \param   degree  The requested degree.
+ * \param   backend The selected backend.
+ * \return  `true`, if the requested backend exists.
+ */
+
+static bool ellipse_c_trig  ( const ellipse_trig_t trig
+                            , const unsigned int degree
+                            , Trig & backend
+                            )
+{
+    switch (trig)
+    {
+        case ELLIPSE_TRIG_LIBM:
+            backend = Trig ();
+            return true;
+
+        case ELLIPSE_TRIG_POLYNOMIAL:
+            backend = Trig (Trig :: polynomial, degree);
+            return true;
+
+        case ELLIPSE_TRIG_TABLE:
+            backend = Trig (Trig :: table, degree);
+            return true;
+    };
+
+    return false;
+}
+
+
+
+/**
+ * \brief   The version of the C interface.
+ * \return  The value of `ELLIPSE_C_VERSION` the library was compiled with.
+ *
+ * Consumers loading the shared library at runtime should compare this value
+ * with the version they were written for.
+ */
+
+ELLIPSE_INLINE unsigned int ellipse_version (void)
+{
+    return ELLIPSE_C_VERSION;
+}
+
+
+
+/**
+ * \brief   Create a new ellipse.
+ * \param   r       The radius.
+ * \param   e       The eccentricity.
+ * \param   centre  The three coordinates of the centre.
+ * \param   tangent The three components of the tangent.
+ * \param   normal  The three components of the normal.
+ * \return  The handle of the new ellipse or `NULL` on failure.
+ *
+ * The ellipse needs to be destroyed by `ellipse_destroy`.
+ */
+
+ELLIPSE_INLINE ellipse_t * ellipse_create   ( float r
+                                            , float e
+                                            , const float * centre
+                                            , const float * tangent
+                                            , const float * normal
+                                            )
+{
+    if (! centre || ! tangent || ! normal)
+        return nullptr;
+
+    try
+    {
+        return reinterpret_cast <ellipse_t *>
+            (new Ellipse    ( r
+                            , e
+                            , centre[0x0]
+                            , centre[0x1]
+                            , centre[0x2]
+                            , tangent[0x0]
+                            , tangent[0x1]
+                            , tangent[0x2]
+                            , normal[0x0]
+                            , normal[0x1]
+                            , normal[0x2]
+                            ));
+    }
+    catch (...)
+    {
+        return nullptr;
+    };
+}
+
+
+
+/**
+ * \brief   Destroy an ellipse.
+ * \param   ellipse The handle of the ellipse, or `NULL`.
+ */
+
+ELLIPSE_INLINE void ellipse_destroy (ellipse_t * ellipse)
+{
+    delete reinterpret_cast <Ellipse *> (ellipse);
+    return;
+}
+
+
+
+/**
+ * \brief   The eccentricity of an ellipse.
+ * \param   ellipse The handle of the ellipse.
+ * \return  The eccentricity.
+ */
+
+ELLIPSE_INLINE float ellipse_get_eccentricity (ellipse_t * ellipse)
+{
+    return reinterpret_cast <Ellipse *> (ellipse) -> get_eccentricity ();
+}
+
+
+
+/**
+ * \brief   The semi-major axis of an ellipse.
+ * \param   ellipse The handle of the ellipse.
+ * \return  The semi-major axis.
+ */
+
+ELLIPSE_INLINE float ellipse_get_major (ellipse_t * ellipse)
+{
+    return reinterpret_cast <Ellipse *> (ellipse) -> get_major ();
+}
+
+
+
+/**
+ * \brief   The semi-minor axis of an ellipse.
+ * \param   ellipse The handle of the ellipse.
+ * \return  The semi-minor axis.
+ */
+
+ELLIPSE_INLINE float ellipse_get_minor (ellipse_t * ellipse)
+{
+    return reinterpret_cast <Ellipse *> (ellipse) -> get_minor ();
+}
+
+
+
+/**
+ * \brief   The radius of an ellipse.
+ * \param   ellipse The handle of the ellipse.
+ * \return  The radius.
+ */
+
+ELLIPSE_INLINE float ellipse_get_radius (ellipse_t * ellipse)
+{
+    return reinterpret_cast <Ellipse *> (ellipse) -> get_radius ();
+}
+
+
+
+/**
+ * \brief   Evaluate an ellipse for a batch of parameter values.
+ * \param   ellipse The handle of the ellipse.
+ * \param   t       The parameter values.
+ * \param   count   The count of parameter values.
+ * \param   x       The x coordinates of the curve points.
+ * \param   y       The y coordinates of the curve points.
+ * \param   z       The z coordinates of the curve points.
+ * \param   trig    The backend computing the sines and the cosines.
+ * \param   degree  The degree of the `polynomial` backend.
+ * \return  The status code.
+ */
+
+ELLIPSE_INLINE ellipse_status_t ellipse_eval    ( const ellipse_t * ellipse
+                                                , ellipse_input_t t
+                                                , size_t count
+                                                , ellipse_output_t x
+                                                , ellipse_output_t y
+                                                , ellipse_output_t z
+                                                , ellipse_trig_t trig
+                                                , unsigned int degree
+                                                )
+{
+    const Ellipse * self    {reinterpret_cast <const Ellipse *> (ellipse)};
+    Trig            backend {};
+
+    if (! self || ! ellipse_c_trig (trig, degree, backend))
+        return ELLIPSE_EARGUMENT;
+
+    const ellipse_input_t   inputs  [0x1]   {t};
+    const ellipse_output_t  outputs [0x3]   {x, y, z};
+
+    return ellipse_c_run (inputs, count, outputs, [&]
+        (const float * (& in) [0x1], const size_t size, float * (& out) [0x3])
+    {
+        self -> eval (in[0x0], size, out[0x0], out[0x1], out[0x2], backend);
+        return;
+    });
+}
+
+
+
+/**
+ * \brief   Evaluate the curvature of an ellipse for a batch of parameters.
+ * \param   ellipse     The handle of the ellipse.
+ * \param   t           The parameter values.
+ * \param   count       The count of parameter values.
+ * \param   curvature   The signed curvatures.
+ * \param   trig        The backend computing the sines and the cosines.
+ * \param   degree      The degree of the `polynomial` backend.
+ * \return  The status code.
+ */
+
+ELLIPSE_INLINE ellipse_status_t ellipse_eval_curvature
+                                                ( const ellipse_t * ellipse
+                                                , ellipse_input_t t
+                                                , size_t count
+                                                , ellipse_output_t curvature
+                                                , ellipse_trig_t trig
+                                                , unsigned int degree
+                                                )
+{
+    const Ellipse * self    {reinterpret_cast <const Ellipse *> (ellipse)};
+    Trig            backend {};
+
+    if (! self || ! ellipse_c_trig (trig, degree, backend))
+        return ELLIPSE_EARGUMENT;
+
+    const ellipse_input_t   inputs  [0x1]   {t};
+    const ellipse_output_t  outputs [0x1]   {curvature};
+
+    return ellipse_c_run (inputs, count, outputs, [&]
+        (const float * (& in) [0x1], const size_t size, float * (& out) [0x1])
+    {
+        self -> eval_curvature (in[0x0], size, out[0x0], backend);
+        return;
+    });
+}
+
+
+
+/**
+ * \brief   Evaluate a derivative of an ellipse for a batch of parameter values.
+ * \param   ellipse The handle of the ellipse.
+ * \param   t       The parameter values.
+ * \param   count   The count of parameter values.
+ * \param   order   The order of the derivative.
+ * \param   dx      The x components of the derivatives.
+ * \param   dy      The y components of the derivatives.
+ * \param   dz      The z components of the derivatives.
+ * \param   trig    The backend computing the sines and the cosines.
+ * \param   degree  The degree of the `polynomial` backend.
+ * \return  The status code.
+ */
+
+ELLIPSE_INLINE ellipse_status_t ellipse_eval_derivative
+                                                ( const ellipse_t * ellipse
+                                                , ellipse_input_t t
+                                                , size_t count
+                                                , unsigned int order
+                                                , ellipse_output_t dx
+                                                , ellipse_output_t dy
+                                                , ellipse_output_t dz
+                                                , ellipse_trig_t trig
+                                                , unsigned int degree
+                                                )
+{
+    const Ellipse * self    {reinterpret_cast <const Ellipse *> (ellipse)};
+    Trig            backend {};
+
+    if (! self || ! ellipse_c_trig (trig, degree, backend))
+        return ELLIPSE_EARGUMENT;
+
+    const ellipse_input_t   inputs  [0x1]   {t};
+    const ellipse_output_t  outputs [0x3]   {dx, dy, dz};
+
+    return ellipse_c_run (inputs, count, outputs, [&]
+        (const float * (& in) [0x1], const size_t size, float * (& out) [0x3])
+    {
+        self -> eval_derivative ( in[0x0]
+                                , size
+                                , order
+                                , out[0x0]
+                                , out[0x1]
+                                , out[0x2]
+                                , backend
+                                );
+        return;
+    });
+}
+
+
+
+/**
+ * \brief   Determine the parameter values of a batch of points.
+ * \param   ellipse The handle of the ellipse.
+ * \param   x       The x coordinates of the points.
+ * \param   y       The y coordinates of the points.
+ * \param   z       The z coordinates of the points.
+ * \param   count   The count of points.
+ * \param   t       The parameter values.
+ * \param   refine  Whether to refine the values to the closest curve points.
+ * \return  The status code.
+ */
+
+ELLIPSE_INLINE ellipse_status_t ellipse_parameter_of
+                                                ( const ellipse_t * ellipse
+                                                , ellipse_input_t x
+                                                , ellipse_input_t y
+                                                , ellipse_input_t z
+                                                , size_t count
+                                                , ellipse_output_t t
+                                                , int refine
+                                                )
+{
+    const Ellipse * self    {reinterpret_cast <const Ellipse *> (ellipse)};
+
+    if (! self)
+        return ELLIPSE_EARGUMENT;
+
+    const ellipse_input_t   inputs  [0x3]   {x, y, z};
+    const ellipse_output_t  outputs [0x1]   {t};
+
+    return ellipse_c_run (inputs, count, outputs, [&]
+        (const float * (& in) [0x3], const size_t size, float * (& out) [0x1])
+    {
+        self -> parameter_of    ( in[0x0]
+                                , in[0x1]
+                                , in[0x2]
+                                , size
+                                , out[0x0]
+                                , refine != 0x0
+                                );
+        return;
+    });
+}
+
+
+
+/**
+ * \brief   Sample points uniformly within an ellipse.
+ * \param   ellipse The handle of the ellipse.
+ * \param   seed    The seed of the random numbers.
+ * \param   count   The count of points.
+ * \param   x       The x coordinates of the points.
+ * \param   y       The y coordinates of the points.
+ * \param   z       The z coordinates of the points.
+ * \param   threads The count of threads to use, or zero for all cores.
+ * \return  The status code.
+ *
+ * Strided outputs are written by a temporary copy.
+ */
+
+ELLIPSE_INLINE ellipse_status_t ellipse_sample_area
+                                                ( const ellipse_t * ellipse
+                                                , uint64_t seed
+                                                , size_t count
+                                                , ellipse_output_t x
+                                                , ellipse_output_t y
+                                                , ellipse_output_t z
+                                                , size_t threads
+                                                )
+{
+    const Ellipse * self    {reinterpret_cast <const Ellipse *> (ellipse)};
+
+    if (! self)
+        return ELLIPSE_EARGUMENT;
+
+    const ellipse_output_t  outputs [0x3]   {x, y, z};
+
+    return ellipse_c_sample (outputs, count, [&] (float * (& out) [0x3])
+    {
+        self -> sample_area ( seed
+                            , count
+                            , out[0x0]
+                            , out[0x1]
+                            , out[0x2]
+                            , threads
+                            );
+        return;
+    });
+}
+
+
+
+/**
+ * \brief   Sample points uniformly on the perimeter of an ellipse.
+ * \param   ellipse The handle of the ellipse.
+ * \param   seed    The seed of the random numbers.
+ * \param   count   The count of points.
+ * \param   x       The x coordinates of the points.
+ * \param   y       The y coordinates of the points.
+ * \param   z       The z coordinates of the points.
+ * \param   threads The count of threads to use, or zero for all cores.
+ * \return  The status code.
+ *
+ * Strided outputs are written by a temporary copy.
+ */
+
+ELLIPSE_INLINE ellipse_status_t ellipse_sample_perimeter
+                                                ( const ellipse_t * ellipse
+                                                , uint64_t seed
+                                                , size_t count
+                                                , ellipse_output_t x
+                                                , ellipse_output_t y
+                                                , ellipse_output_t z
+                                                , size_t threads
+                                                )
+{
+    const Ellipse * self    {reinterpret_cast <const Ellipse *> (ellipse)};
+
+    if (! self)
+        return ELLIPSE_EARGUMENT;
+
+    const ellipse_output_t  outputs [0x3]   {x, y, z};
+
+    return ellipse_c_sample (outputs, count, [&] (float * (& out) [0x3])
+    {
+        self -> sample_perimeter    ( seed
+                                    , count
+                                    , out[0x0]
+                                    , out[0x1]
+                                    , out[0x2]
+                                    , threads
+                                    );
+        return;
+    });
+}
+
+
+
+/**
+ * \brief   Evaluate an ellipse in world coordinates for a batch of parameters.
+ * \param   ellipse The handle of the ellipse.
+ * \param   t       The parameter values.
+ * \param   count   The count of parameter values.
+ * \param   x       The x coordinates of the placed curve points.
+ * \param   y       The y coordinates of the placed curve points.
+ * \param   z       The z coordinates of the placed curve points.
+ * \param   trig    The backend computing the sines and the cosines.
+ * \param   degree  The degree of the `polynomial` backend.
+ * \return  The status code.
+ */
+
+ELLIPSE_INLINE ellipse_status_t ellipse_eval_world
+                                                ( const ellipse_t * ellipse
+                                                , ellipse_input_t t
+                                                , size_t count
+                                                , ellipse_output_t x
+                                                , ellipse_output_t y
+                                                , ellipse_output_t z
+                                                , ellipse_trig_t trig
+                                                , unsigned int degree
+                                                )
+{
+    const Ellipse * self    {reinterpret_cast <const Ellipse *> (ellipse)};
+    Trig            backend {};
+
+    if (! self || ! ellipse_c_trig (trig, degree, backend))
+        return ELLIPSE_EARGUMENT;
+
+    const ellipse_input_t   inputs  [0x1]   {t};
+    const ellipse_output_t  outputs [0x3]   {x, y, z};
+
+    return ellipse_c_run (inputs, count, outputs, [&]
+        (const float * (& in) [0x1], const size_t size, float * (& out) [0x3])
+    {
+        self -> eval_world  ( in[0x0]
+                            , size
+                            , out[0x0]
+                            , out[0x1]
+                            , out[0x2]
+                            , backend
+                            );
+        return;
+    });
+}
+
+/******************************************************************************/
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The C interface of the library.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        ellipse_c.h
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This header declares a C interface to the `Ellipse` class for consumers
+ * written in other languages, for instance Python by `ctypes` or Rust by its
+ * foreign function interface.
+ *
+ * Ellipses are referred to by opaque handles.  The batch functions take arrays
+ * as a pointer together with a stride in bytes, such that NumPy arrays and
+ * slices can be passed without copying them.  Contiguous arrays are processed
+ * by the batch kernels of the `Ellipse` class directly.  Other strides are
+ * gathered and scattered in blocks on the stack.
+ *
+ * The interface is stable:  functions and members are only appended, existing
+ * signatures are not changed.  `ELLIPSE_C_VERSION` is increased with each
+ * addition.
+ */
+
+/******************************************************************************/
+
+/*
+ * Security settings.
+ */
+
+#pragma once
+#ifndef __ELLIPSE_C_H__
+#define __ELLIPSE_C_H__
+
+
+
+/*
+ * Includes.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "EXPORT.hpp"
+
+
+
+/*
+ * Settings.
+ */
+
+#define ELLIPSE_C_VERSION   0x2
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif  // ! __cplusplus
+
+
+
+/**
+ * \brief   An opaque handle of an ellipse.
+ */
+
+typedef struct ellipse  ellipse_t;
+
+/**
+ * \brief   A read-only array of `float` values.
+ *
+ * The elements are `stride` bytes apart from each other, as for instance given
+ * by the strides of a NumPy array.  Contiguous arrays have a stride of
+ * `sizeof (float)`.  A stride of zero repeats the first element.
+ */
+
+typedef struct
+{
+    const float *   data;
+    ptrdiff_t       stride;
+} ellipse_input_t;
+
+/**
+ * \brief   A writable array of `float` values.
+ *
+ * The elements are `stride` bytes apart from each other.  Contiguous arrays
+ * have a stride of `sizeof (float)`.
+ */
+
+typedef struct
+{
+    float *     data;
+    ptrdiff_t   stride;
+} ellipse_output_t;
+
+/**
+ * \brief   The status codes of the batch functions.
+ */
+
+typedef enum
+{
+    ELLIPSE_OK          = 0x0,
+    ELLIPSE_EARGUMENT   = 0x1,
+    ELLIPSE_ERESOURCE   = 0x2
+} ellipse_status_t;
+
+/**
+ * \brief   The backends computing sines and cosines.
+ *
+ * See the `Trig` class for their accuracy.
+ */
+
+typedef enum
+{
+    ELLIPSE_TRIG_LIBM       = 0x0,
+    ELLIPSE_TRIG_POLYNOMIAL = 0x1,
+    ELLIPSE_TRIG_TABLE      = 0x2
+} ellipse_trig_t;
+
+EXPORT  unsigned int    ellipse_version (void);
+
+EXPORT  ellipse_t * ellipse_create  ( float r
+                                    , float e
+                                    , const float * centre
+                                    , const float * tangent
+                                    , const float * normal
+                                    );
+EXPORT  void        ellipse_destroy (ellipse_t * ellipse);
+
+EXPORT  float   ellipse_get_eccentricity    (ellipse_t * ellipse);
+EXPORT  float   ellipse_get_major           (ellipse_t * ellipse);
+EXPORT  float   ellipse_get_minor           (ellipse_t * ellipse);
+EXPORT  float   ellipse_get_radius          (ellipse_t * ellipse);
+
+EXPORT  ellipse_status_t    ellipse_eval    ( const ellipse_t * ellipse
+                                            , ellipse_input_t t
+                                            , size_t count
+                                            , ellipse_output_t x
+                                            , ellipse_output_t y
+                                            , ellipse_output_t z
+                                            , ellipse_trig_t trig
+                                            , unsigned int degree
+                                            );
+EXPORT  ellipse_status_t    ellipse_eval_curvature
+                                            ( const ellipse_t * ellipse
+                                            , ellipse_input_t t
+                                            , size_t count
+                                            , ellipse_output_t curvature
+                                            , ellipse_trig_t trig
+                                            , unsigned int degree
+                                            );
+EXPORT  ellipse_status_t    ellipse_eval_derivative
+                                            ( const ellipse_t * ellipse
+                                            , ellipse_input_t t
+                                            , size_t count
+                                            , unsigned int order
+                                            , ellipse_output_t dx
+                                            , ellipse_output_t dy
+                                            , ellipse_output_t dz
+                                            , ellipse_trig_t trig
+                                            , unsigned int degree
+                                            );
+EXPORT  ellipse_status_t    ellipse_parameter_of
+                                            ( const ellipse_t * ellipse
+                                            , ellipse_input_t x
+                                            , ellipse_input_t y
+                                            , ellipse_input_t z
+                                            , size_t count
+                                            , ellipse_output_t t
+                                            , int refine
+                                            );
+EXPORT  ellipse_status_t    ellipse_sample_area
+                                            ( const ellipse_t * ellipse
+                                            , uint64_t seed
+                                            , size_t count
+                                            , ellipse_output_t x
+                                            , ellipse_output_t y
+                                            , ellipse_output_t z
+                                            , size_t threads
+                                            );
+EXPORT  ellipse_status_t    ellipse_sample_perimeter
+                                            ( const ellipse_t * ellipse
+                                            , uint64_t seed
+                                            , size_t count
+                                            , ellipse_output_t x
+                                            , ellipse_output_t y
+                                            , ellipse_output_t z
+                                            , size_t threads
+                                            );
+EXPORT  ellipse_status_t    ellipse_eval_world
+                                            ( const ellipse_t * ellipse
+                                            , ellipse_input_t t
+                                            , size_t count
+                                            , ellipse_output_t x
+                                            , ellipse_output_t y
+                                            , ellipse_output_t z
+                                            , ellipse_trig_t trig
+                                            , unsigned int degree
+                                            );
+
+
+
+/*
+ * End of header.
+ */
+
+#ifdef  __cplusplus
+}
+#endif  // ! __cplusplus
+
+// Leaving the header.
+#endif  // ! __ELLIPSE_C_H__
+
+/******************************************************************************/
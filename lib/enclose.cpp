@@ -0,0 +1,426 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The minimum-volume ellipse enclosing a set of points.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        enclose.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Tolerance zones and summaries of clusters of points require the smallest
+ * ellipse containing all of the points.  This file defines its construction by
+ * an iterative algorithm on a core set of the points whose scans over all
+ * points are distributed among threads.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+
+
+/**
+ * \brief   Determine the smallest ellipse enclosing a set of points.
+ * \param   x           The x coordinates of the points.
+ * \param   y           The y coordinates of the points.
+ * \param   count       The count of points.
+ * \param   tolerance   The relative tolerance of the enclosing ellipse.
+ * \param   ellipse     The resulting ellipse.
+ * \param   threads     The count of threads to use, or zero for all cores.
+ * \return  Whether an enclosing ellipse exists.
+ *
+ * The minimum-volume enclosing ellipse is determined by the algorithm of
+ * Khachiyan with the away steps of Todd and Yildirim.  For weights `u` summing
+ * up to one, the weighted mean `c` and covariance `S` of the points are
+ * determined.  Then, each iteration determines the point with the greatest
+ * and the supported point with the least value of `1 + (p - c)^T S^-1 (p -
+ * c)`.  The weight of the former is increased or the one of the latter is
+ * decreased, whichever is further from the optimal value 3.  The iteration
+ * stops when all values are within `3 (1 +- tolerance)`.  The ellipse is then
+ * given by the centre `c` and the shape `S^-1 / 2`.
+ *
+ * Since the ellipse is only supported by a few points, the iteration is
+ * applied to a core set only.  It is initialised by the extreme points in the
+ * directions of the axes and the diagonals.  Then, all points are scanned for
+ * the ellipse of the core set, adding the point furthest outside of each
+ * chunk of 16384 points to the core set as long as any point lies further
+ * outside than the tolerance.  The chunks are distributed dynamically among
+ * the threads and the results are reduced in the order of the chunks such
+ * that the result does not depend on the count of threads.
+ *
+ * Finally, the ellipse of the core set is scaled such that it encloses all
+ * points, touching the furthest one.  It is placed within the x-y plane as by
+ * `from_conic`.  In case there are less than three points or all points are
+ * collinear, `ellipse` is not changed.
+ */
+
+ELLIPSE_INLINE bool Ellipse :: enclose    ( const float * x
+                                          , const float * y
+                                          , const size_t count
+                                          , const float tolerance
+                                          , Ellipse & ellipse
+                                          , const size_t threads
+                                          )
+{
+    ELLIPSE_COUNT ("enclose");
+    ELLIPSE_TIME ("enclose");
+
+    if (count < 0x3)
+        return false;
+
+    const size_t    size        {0x4000};
+    const size_t    chunks      {(count + size - 0x1) / size};
+    const size_t    directions  {0x8};
+    const double    epsilon     {std :: max (double (tolerance), 1e-7)};
+    const double    ox          {x[0x0]};
+    const double    oy          {y[0x0]};
+
+    const size_t    cores   {std :: thread :: hardware_concurrency ()};
+    const size_t    wanted  {threads ? threads : cores ? cores : 0x1};
+    const size_t    workers {std :: min (wanted, chunks)};
+
+    const auto  parallel    = [&] (const function <void (size_t)> & chunk)
+        -> void
+    {
+        std :: atomic <size_t>  next    {0x0};
+
+        const auto  work    = [&] (void) -> void
+        {
+            for (size_t i = next++; i < chunks; i = next++)
+                chunk (i);
+
+            return;
+        };
+
+        vector <std :: thread>  pool    {};
+
+        for (size_t i = 0x1; i < workers; i++)
+            pool.emplace_back (work);
+
+        work ();
+
+        for (std :: thread & thread : pool)
+            thread.join ();
+
+        return;
+    };
+
+    const auto  projection  = [x, y] (const size_t i, const size_t k)
+        -> double
+    {
+        const double    px  {x[i]};
+        const double    py  {y[i]};
+        const double    ret [0x4]   {px, py, px + py, px - py};
+
+        return k % 0x2 ? - ret[k / 0x2] : ret[k / 0x2];
+    };
+
+    ELLIPSE_ALLOCATE (chunks * (directions + 0x1) * sizeof (size_t));
+
+    vector <size_t> extremes    (chunks * directions);
+    vector <size_t> furthest    (chunks);
+    vector <double> distances   (chunks);
+
+    parallel ([&] (const size_t chunk) -> void
+    {
+        const size_t    begin   {chunk * size};
+        const size_t    end     {std :: min (begin + size, count)};
+        size_t *        best    {extremes.data () + chunk * directions};
+
+        for (size_t k = 0x0; k < directions; k++)
+        {
+            best[k] = begin;
+
+            for (size_t i = begin + 0x1; i < end; i++)
+                if (projection (i, k) > projection (best[k], k))
+                    best[k] = i;
+        };
+
+        return;
+    });
+
+    vector <size_t> core    {};
+
+    for (size_t k = 0x0; k < directions; k++)
+    {
+        size_t  best    {extremes[k]};
+
+        for (size_t chunk = 0x1; chunk < chunks; chunk++)
+        {
+            const size_t    i   {extremes[chunk * directions + k]};
+
+            if (projection (i, k) > projection (best, k))
+                best = i;
+        };
+
+        if (std :: find (core.begin (), core.end (), best) == core.end ())
+            core.push_back (best);
+    };
+
+    const size_t    base    {core[0x0]};
+    size_t          other   {core[0x0]};
+
+    for (const size_t i : core)
+        if  ( std :: abs (double (x[i]) - x[base])
+            + std :: abs (double (y[i]) - y[base])
+            > std :: abs (double (x[other]) - x[base])
+            + std :: abs (double (y[other]) - y[base])
+            )
+            other = i;
+
+    const double    dx  {double (x[other]) - x[base]};
+    const double    dy  {double (y[other]) - y[base]};
+
+    parallel ([&] (const size_t chunk) -> void
+    {
+        const size_t    begin   {chunk * size};
+        const size_t    end     {std :: min (begin + size, count)};
+
+        furthest[chunk]     = begin;
+        distances[chunk]    = 0.;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            const double    cross
+                {std :: abs (dx * (y[i] - y[base]) - dy * (x[i] - x[base]))};
+
+            if (cross > distances[chunk])
+            {
+                distances[chunk]    = cross;
+                furthest[chunk]     = i;
+            };
+        };
+
+        return;
+    });
+
+    const size_t    apex
+        {furthest[size_t (std :: max_element (distances.begin ()
+                                             , distances.end ()
+                                             )
+                         - distances.begin ()
+                         )]
+        };
+
+    const double    height
+        {std :: abs (dx * (y[apex] - y[base]) - dy * (x[apex] - x[base]))};
+
+    if (! (height > 1e-9 * (dx * dx + dy * dy)))
+        return false;
+
+    if (std :: find (core.begin (), core.end (), apex) == core.end ())
+        core.push_back (apex);
+
+    vector <double> weight  (core.size (), 1. / double (core.size ()));
+    double          shape   [0x2][0x2]  {};
+    double          centre  [0x2]       {};
+
+    const auto  fit = [&] (void) -> bool
+    {
+        double  moment  [0x3]   {};
+
+        centre[0x0] = 0.;
+        centre[0x1] = 0.;
+
+        for (size_t i = 0x0; i < core.size (); i++)
+        {
+            const double    px  {x[core[i]] - ox};
+            const double    py  {y[core[i]] - oy};
+
+            centre[0x0] += weight[i] * px;
+            centre[0x1] += weight[i] * py;
+            moment[0x0] += weight[i] * px * px;
+            moment[0x1] += weight[i] * px * py;
+            moment[0x2] += weight[i] * py * py;
+        };
+
+        const double    sxx {moment[0x0] - centre[0x0] * centre[0x0]};
+        const double    sxy {moment[0x1] - centre[0x0] * centre[0x1]};
+        const double    syy {moment[0x2] - centre[0x1] * centre[0x1]};
+        const double    det {sxx * syy - sxy * sxy};
+
+        if (! (det > 1e-12 * (sxx * sxx + syy * syy)))
+            return false;
+
+        shape[0x0][0x0] = syy / det;
+        shape[0x0][0x1] = - sxy / det;
+        shape[0x1][0x0] = - sxy / det;
+        shape[0x1][0x1] = sxx / det;
+
+        return true;
+    };
+
+    for (size_t round = 0x0; round < 0x40; round++)
+    {
+        const size_t    m   {core.size ()};
+        vector <double> value   (m);
+
+        for (size_t iteration = 0x0; iteration < 0x10000; iteration++)
+        {
+            if (! fit ())
+                return false;
+
+            size_t  up      {0x0};
+            size_t  down    {m};
+
+            for (size_t i = 0x0; i < m; i++)
+            {
+                const double    px  {x[core[i]] - ox - centre[0x0]};
+                const double    py  {y[core[i]] - oy - centre[0x1]};
+
+                value[i]    = 1.
+                            + shape[0x0][0x0] * px * px
+                            + 2. * shape[0x0][0x1] * px * py
+                            + shape[0x1][0x1] * py * py;
+
+                if (value[i] > value[up])
+                    up = i;
+
+                if (weight[i] > 0. && (down == m || value[i] < value[down]))
+                    down = i;
+            };
+
+            if  ( value[up] <= 3. * (1. + epsilon)
+                && value[down] >= 3. * (1. - epsilon)
+                )
+                break;
+
+            const size_t    k
+                {value[up] - 3. >= 3. - value[down] ? up : down};
+            const double    step
+                {std :: max ( (value[k] - 3.) / (3. * (value[k] - 1.))
+                            , - weight[k] / (1. - weight[k])
+                            )
+                };
+
+            for (size_t i = 0x0; i < m; i++)
+                weight[i] *= 1. - step;
+
+            weight[k] = std :: max (weight[k] + step, 0.);
+        };
+
+        if (! fit ())
+            return false;
+
+        for (size_t r = 0x0; r < 0x2; r++)
+            for (size_t c = 0x0; c < 0x2; c++)
+                shape[r][c] *= 0.5;
+
+        parallel ([&] (const size_t chunk) -> void
+        {
+            const size_t    block   {0x100};
+            const size_t    begin   {chunk * size};
+            const size_t    end     {std :: min (begin + size, count)};
+            const double    cx      {centre[0x0] + ox};
+            const double    cy      {centre[0x1] + oy};
+            const double    a       {shape[0x0][0x0]};
+            const double    b       {shape[0x0][0x1]};
+            const double    d       {shape[0x1][0x1]};
+            double          r       [block];
+
+            furthest[chunk]     = begin;
+            distances[chunk]    = 0.;
+
+            for (size_t first = begin; first < end; first += block)
+            {
+                const size_t    length  {std :: min (block, end - first)};
+
+#pragma omp simd
+                for (size_t i = 0x0; i < length; i++)
+                {
+                    const double    px  {x[first + i] - cx};
+                    const double    py  {y[first + i] - cy};
+
+                    r[i] = a * px * px + 2. * b * px * py + d * py * py;
+                };
+
+                for (size_t i = 0x0; i < length; i++)
+                    if (r[i] > distances[chunk])
+                    {
+                        distances[chunk]    = r[i];
+                        furthest[chunk]     = first + i;
+                    };
+            };
+
+            return;
+        });
+
+        double  maximum {0.};
+        size_t  added   {0x0};
+
+        for (size_t chunk = 0x0; chunk < chunks; chunk++)
+        {
+            maximum = std :: max (maximum, distances[chunk]);
+
+            if  ( distances[chunk] > 1. + epsilon
+                && std :: find (core.begin (), core.end (), furthest[chunk])
+                   == core.end ()
+                )
+            {
+                core.push_back (furthest[chunk]);
+                weight.push_back (0.);
+                added++;
+            };
+        };
+
+        if (! added || round == 0x3f)
+        {
+            const double    scale   {maximum > 0. ? maximum : 1.};
+
+            for (size_t r = 0x0; r < 0x2; r++)
+                for (size_t c = 0x0; c < 0x2; c++)
+                    shape[r][c] /= scale;
+
+            break;
+        };
+    };
+
+    const double    cx  {centre[0x0] + ox};
+    const double    cy  {centre[0x1] + oy};
+    const double    p   {shape[0x0][0x0]};
+    const double    q   {shape[0x0][0x1]};
+    const double    r   {shape[0x1][0x1]};
+    Conic           conic   {};
+
+    conic.matrix[0x0][0x0]  = p;
+    conic.matrix[0x0][0x1]  = q;
+    conic.matrix[0x1][0x1]  = r;
+    conic.matrix[0x0][0x2]  = - (p * cx + q * cy);
+    conic.matrix[0x1][0x2]  = - (q * cx + r * cy);
+    conic.matrix[0x2][0x2]
+        = p * cx * cx + 2. * q * cx * cy + r * cy * cy - 1.;
+    conic.matrix[0x1][0x0]  = conic.matrix[0x0][0x1];
+    conic.matrix[0x2][0x0]  = conic.matrix[0x0][0x2];
+    conic.matrix[0x2][0x1]  = conic.matrix[0x1][0x2];
+
+    return Ellipse :: from_conic (conic, ellipse);
+}
+
+/******************************************************************************/
@@ -31,7 +31,9 @@
  * passed to this method, `eval`.
  *
  * Sometimes, the parameter value shall be evaluated with a certain offset.
- * Therefore, this file defines a set of overloads.
+ * Therefore, this file defines a set of overloads.  Furthermore, there is an
+ * overload for evaluating a whole batch of parameter values at once.  The
+ * backend computing the sines and cosines can be chosen per call.
  */
 
 /******************************************************************************/
@@ -64,10 +66,15 @@
  * x, y and z coordinates of the determined curve point in this order.
  */
 
+ELLIPSE_INLINE
 vector <float> Ellipse :: eval (const float t, const float offset)
 {
+    ELLIPSE_COUNT ("eval");
+    ELLIPSE_ALLOCATE (0x3 * sizeof (float));
+
     vector <float>  ret {};
 
+    ret.reserve (0x3);
     ret.push_back (this -> x (t + offset));
     ret.push_back (this -> y (t + offset));
     ret.push_back (this -> z (t + offset));
@@ -87,10 +94,116 @@ vector <float> Ellipse :: eval (const float t, const float offset)
  * the intended curve point without any offset.
  */
 
-inline vector <float> Ellipse :: eval (const float t)
+ELLIPSE_INLINE vector <float> Ellipse :: eval (const float t)
 {
     return Ellipse :: eval (t, 0x0);
 }
 
 
+
+/**
+ * \brief   Evaluate this ellipse with a certain trigonometric backend.
+ * \param   t       The point of time to evaluate this ellipse for.
+ * \param   trig    The backend computing the sine and the cosine.
+ * \return  The evaluated curve point.
+ *
+ * This overload evaluates the curve point directly instead of calling the
+ * stored parametrisation such that the accuracy can be chosen per call.  Apart
+ * from the final rounding, the error of the coordinates is bounded by
+ * `trig.bound ()` times the respective semi-axis.
+ */
+
+ELLIPSE_INLINE
+vector <float> Ellipse :: eval (const float t, const Trig & trig) const
+{
+    ELLIPSE_COUNT ("eval (trig)");
+    ELLIPSE_ALLOCATE (0x3 * sizeof (float));
+
+    vector <float>  ret (0x3);
+
+    this -> eval (& t, 0x1, & ret[0x0], & ret[0x1], & ret[0x2], trig);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Evaluate this ellipse for a batch of parameter values.
+ * \param   t       The parameter values to evaluate this ellipse for.
+ * \param   count   The count of parameter values.
+ * \param   x       The x coordinates of the curve points.
+ * \param   y       The y coordinates of the curve points.
+ * \param   z       The z coordinates of the curve points.
+ *
+ * This overload writes the coordinates of the curve points into the given
+ * arrays which need to provide space for `count` elements each.  As for the
+ * other overloads, these are the coordinates within the local frame of this
+ * ellipse, see `eval_world` for placed curve points.  It neither
+ * allocates memory nor calls the stored parametrisation per point.  The sines
+ * and cosines are computed by the C standard library.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval ( const float * t
+                                    , const size_t count
+                                    , float * x
+                                    , float * y
+                                    , float * z
+                                    ) const
+{
+    this -> eval (t, count, x, y, z, Trig ());
+    return;
+}
+
+
+
+/**
+ * \brief   Evaluate this ellipse for a batch of parameter values.
+ * \param   t       The parameter values to evaluate this ellipse for.
+ * \param   count   The count of parameter values.
+ * \param   x       The x coordinates of the curve points.
+ * \param   y       The y coordinates of the curve points.
+ * \param   z       The z coordinates of the curve points.
+ * \param   trig    The backend computing the sines and the cosines.
+ *
+ * The sines and cosines of blocks of 256 parameter values are computed by the
+ * given backend at first.  Then, the coordinates are determined in SIMD lanes.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval ( const float * t
+                                    , const size_t count
+                                    , float * x
+                                    , float * y
+                                    , float * z
+                                    , const Trig & trig
+                                    ) const
+{
+    ELLIPSE_COUNT ("eval (batch)");
+    ELLIPSE_TIME ("eval (batch)");
+
+    const size_t    block   {0x100};
+    const float     major   {this -> major};
+    const float     minor   {this -> minor};
+
+    float   cosine  [block];
+    float   sine    [block];
+
+    for (size_t begin = 0x0; begin < count; begin += block)
+    {
+        const size_t    size    {count - begin < block ? count - begin : block};
+
+        trig.sincos (t + begin, size, sine, cosine);
+
+#pragma omp simd
+        for (size_t i = 0x0; i < size; i++)
+        {
+            x[begin + i]    = major * cosine[i];
+            y[begin + i]    = minor * sine[i];
+            z[begin + i]    = 0.f;
+        };
+    };
+
+    return;
+}
+
 /******************************************************************************/
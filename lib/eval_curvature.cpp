@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Evaluate the curvature of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        eval_curvature.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The curvature of a curve point is the reciprocal of the radius of its
+ * osculating circle.  It is the greatest at the ends of the major axis and the
+ * least at the ends of the minor axis.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Evaluate the curvature of this ellipse.
+ * \param   t   The parameter value to evaluate the curvature for.
+ * \return  The curvature.
+ *
+ * This overload calls the batch overload for a single parameter value.
+ */
+
+ELLIPSE_INLINE float Ellipse :: eval_curvature (const float t) const
+{
+    ELLIPSE_COUNT ("eval_curvature");
+
+    float   ret {0.f};
+
+    this -> eval_curvature (& t, 0x1, & ret, Trig ());
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Evaluate the curvature of this ellipse for a batch.
+ * \param   t           The parameter values to evaluate the curvature for.
+ * \param   count       The count of parameter values.
+ * \param   curvature   The curvatures.
+ *
+ * For the parametrisation `(a cos t, b sin t)`, the curvature equals
+ * `a b / (a^2 sin^2 t + b^2 cos^2 t)^(3/2)`.  In case of a degenerate ellipse
+ * whose velocity vanishes, the curvature is set to zero.  The sines and cosines
+ * are computed by the C standard library.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_curvature   ( const float * t
+                                                , const size_t count
+                                                , float * curvature
+                                                ) const
+{
+    this -> eval_curvature (t, count, curvature, Trig ());
+    return;
+}
+
+
+
+/**
+ * \brief   Evaluate the curvature of this ellipse for a batch.
+ * \param   t           The parameter values to evaluate the curvature for.
+ * \param   count       The count of parameter values.
+ * \param   curvature   The curvatures.
+ * \param   trig        The backend computing the sines and the cosines.
+ *
+ * The sines and cosines of blocks of 256 parameter values are computed by the
+ * given backend at first.  Then, the curvatures are determined in SIMD lanes.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_curvature   ( const float * t
+                                                , const size_t count
+                                                , float * curvature
+                                                , const Trig & trig
+                                                ) const
+{
+    ELLIPSE_COUNT ("eval_curvature (batch)");
+    ELLIPSE_TIME ("eval_curvature (batch)");
+
+    const size_t    block   {0x100};
+    const float     major   {this -> major};
+    const float     minor   {this -> minor};
+    const float     product {major * minor};
+
+    float   cosine  [block];
+    float   sine    [block];
+
+    for (size_t begin = 0x0; begin < count; begin += block)
+    {
+        const size_t    size    {count - begin < block ? count - begin : block};
+
+        trig.sincos (t + begin, size, sine, cosine);
+
+#pragma omp simd
+        for (size_t i = 0x0; i < size; i++)
+        {
+            const float vx      {major * sine[i]};
+            const float vy      {minor * cosine[i]};
+            const float squared {vx * vx + vy * vy};
+
+            curvature[begin + i]    = squared > 0.f
+                                    ? product / (squared * sqrt (squared))
+                                    : 0.f;
+        };
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Evaluate derivatives of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        eval_derivative.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The derivatives of the parametrisation are required in order to determine the
+ * velocity along the curve or its local orientation.  This file defines a set
+ * of overloads for their evaluation.
+ *
+ * Since all derivatives of sine and cosine are sines and cosines again, the
+ * derivative of any order can be evaluated by a phase shift of a quarter period
+ * per order.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Evaluate a derivative of this ellipse.
+ * \param   t       The parameter value to evaluate the derivative for.
+ * \param   order   The order of the derivative.
+ * \return  The derivative.
+ *
+ * The derivative of order zero is the curve point itself.  The returned vector
+ * contains the x, y and z components of the derivative in this order.
+ */
+
+ELLIPSE_INLINE vector <float> Ellipse :: eval_derivative
+    ( const float t
+    , const unsigned int order
+    ) const
+{
+    ELLIPSE_COUNT ("eval_derivative");
+    ELLIPSE_ALLOCATE (0x3 * sizeof (float));
+
+    vector <float>  ret (0x3);
+
+    this -> eval_derivative
+        (& t, 0x1, order, & ret[0x0], & ret[0x1], & ret[0x2]);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Evaluate the first derivative of this ellipse.
+ * \param   t   The parameter value to evaluate the derivative for.
+ * \return  The velocity vector.
+ *
+ * This overload calls the other one with `order` being set to one.
+ */
+
+ELLIPSE_INLINE vector <float> Ellipse :: eval_derivative (const float t) const
+{
+    return this -> eval_derivative (t, 0x1);
+}
+
+
+
+/**
+ * \brief   Evaluate a derivative of this ellipse for a batch of parameters.
+ * \param   t       The parameter values to evaluate the derivative for.
+ * \param   count   The count of parameter values.
+ * \param   order   The order of the derivative.
+ * \param   dx      The x components of the derivatives.
+ * \param   dy      The y components of the derivatives.
+ * \param   dz      The z components of the derivatives.
+ *
+ * Sine and cosine are computed once per parameter value.  The order only
+ * determines how they are combined.  Thus, all orders share the same costs.
+ * The sines and cosines are computed by the C standard library.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_derivative  ( const float * t
+                                                , const size_t count
+                                                , const unsigned int order
+                                                , float * dx
+                                                , float * dy
+                                                , float * dz
+                                                ) const
+{
+    this -> eval_derivative (t, count, order, dx, dy, dz, Trig ());
+    return;
+}
+
+
+
+/**
+ * \brief   Evaluate a derivative of this ellipse for a batch of parameters.
+ * \param   t       The parameter values to evaluate the derivative for.
+ * \param   count   The count of parameter values.
+ * \param   order   The order of the derivative.
+ * \param   dx      The x components of the derivatives.
+ * \param   dy      The y components of the derivatives.
+ * \param   dz      The z components of the derivatives.
+ * \param   trig    The backend computing the sines and the cosines.
+ *
+ * The sines and cosines of blocks of 256 parameter values are computed by the
+ * given backend at first.  Then, the derivatives are determined in SIMD lanes.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_derivative  ( const float * t
+                                                , const size_t count
+                                                , const unsigned int order
+                                                , float * dx
+                                                , float * dy
+                                                , float * dz
+                                                , const Trig & trig
+                                                ) const
+{
+    ELLIPSE_COUNT ("eval_derivative (batch)");
+    ELLIPSE_TIME ("eval_derivative (batch)");
+
+    float   ac  {0.f};
+    float   as  {0.f};
+    float   bc  {0.f};
+    float   bs  {0.f};
+
+    switch (order % 0x4)
+    {
+        case 0x0:
+            ac  =   this -> major;
+            bs  =   this -> minor;
+            break;
+
+        case 0x1:
+            as  = - this -> major;
+            bc  =   this -> minor;
+            break;
+
+        case 0x2:
+            ac  = - this -> major;
+            bs  = - this -> minor;
+            break;
+
+        default:
+            as  =   this -> major;
+            bc  = - this -> minor;
+            break;
+    };
+
+    const size_t    block   {0x100};
+
+    float   cosine  [block];
+    float   sine    [block];
+
+    for (size_t begin = 0x0; begin < count; begin += block)
+    {
+        const size_t    size    {count - begin < block ? count - begin : block};
+
+        trig.sincos (t + begin, size, sine, cosine);
+
+#pragma omp simd
+        for (size_t i = 0x0; i < size; i++)
+        {
+            dx[begin + i]   = ac * cosine[i] + as * sine[i];
+            dy[begin + i]   = bc * cosine[i] + bs * sine[i];
+            dz[begin + i]   = 0.f;
+        };
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Evaluate moving frames of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        eval_frame.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The moving frame of a curve point consists of the point itself, the unit
+ * tangent and the unit normal.  It is required for stroking and offsetting the
+ * curve as well as for physical simulations.
+ *
+ * All quantities are derived from the same sine and cosine such that one pass
+ * over the parameter values yields all of them, including the curvature.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Evaluate the moving frame of this ellipse.
+ * \param   t   The parameter value to evaluate the frame for.
+ * \return  The curve point together with its unit tangent and unit normal.
+ *
+ * This overload calls the batch overload for a single parameter value.
+ */
+
+ELLIPSE_INLINE Ellipse :: Frame Ellipse :: eval_frame (const float t) const
+{
+    ELLIPSE_COUNT ("eval_frame");
+
+    Frame   ret         {};
+    float   curvature   {0.f};
+    Frames  frames      {};
+
+    for (size_t i = 0x0; i < 0x3; i++)
+    {
+        frames.position[i]  = & ret.position[i];
+        frames.tangent[i]   = & ret.tangent[i];
+        frames.normal[i]    = & ret.normal[i];
+    };
+
+    frames.curvature    = & curvature;
+
+    this -> eval_frame (& t, 0x1, frames);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Evaluate the moving frames of this ellipse for a batch.
+ * \param   t       The parameter values to evaluate the frames for.
+ * \param   count   The count of parameter values.
+ * \param   frames  The output arrays.
+ *
+ * The tangent is the normalised first derivative.  The normal is the tangent
+ * rotated by a right angle within the ellipse's plane such that it points away
+ * from the centre.  The curvature is the reciprocal of the radius of the
+ * osculating circle.
+ *
+ * In case of a degenerate ellipse whose velocity vanishes, tangent, normal and
+ * curvature are set to zero.  The sines and cosines are computed by the C
+ * standard library.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_frame   ( const float * t
+                                            , const size_t count
+                                            , const Frames & frames
+                                            ) const
+{
+    this -> eval_frame (t, count, frames, Trig ());
+    return;
+}
+
+
+
+/**
+ * \brief   Evaluate the moving frames of this ellipse for a batch.
+ * \param   t       The parameter values to evaluate the frames for.
+ * \param   count   The count of parameter values.
+ * \param   frames  The output arrays.
+ * \param   trig    The backend computing the sines and the cosines.
+ *
+ * The sines and cosines of blocks of 256 parameter values are computed by the
+ * given backend at first.  Then, the frames are determined in SIMD lanes.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_frame   ( const float * t
+                                            , const size_t count
+                                            , const Frames & frames
+                                            , const Trig & trig
+                                            ) const
+{
+    ELLIPSE_COUNT ("eval_frame (batch)");
+    ELLIPSE_TIME ("eval_frame (batch)");
+
+    const float major   {this -> major};
+    const float minor   {this -> minor};
+    const float product {major * minor};
+
+    float * const   px  {frames.position[0x0]};
+    float * const   py  {frames.position[0x1]};
+    float * const   pz  {frames.position[0x2]};
+    float * const   tx  {frames.tangent[0x0]};
+    float * const   ty  {frames.tangent[0x1]};
+    float * const   tz  {frames.tangent[0x2]};
+    float * const   nx  {frames.normal[0x0]};
+    float * const   ny  {frames.normal[0x1]};
+    float * const   nz  {frames.normal[0x2]};
+    float * const   k   {frames.curvature};
+
+    const size_t    block   {0x100};
+
+    float   cosine  [block];
+    float   sine    [block];
+
+    for (size_t begin = 0x0; begin < count; begin += block)
+    {
+        const size_t    size    {count - begin < block ? count - begin : block};
+
+        trig.sincos (t + begin, size, sine, cosine);
+
+#pragma omp simd
+        for (size_t i = 0x0; i < size; i++)
+        {
+            const size_t    j       {begin + i};
+            const float     c       {cosine[i]};
+            const float     s       {sine[i]};
+            const float     vx      {- major * s};
+            const float     vy      {minor * c};
+            const float     speed   {sqrt (vx * vx + vy * vy)};
+            const float     inverse {speed > 0.f ? 1.f / speed : 0.f};
+
+            px[j]   = major * c;
+            py[j]   = minor * s;
+            pz[j]   = 0.f;
+            tx[j]   = vx * inverse;
+            ty[j]   = vy * inverse;
+            tz[j]   = 0.f;
+            nx[j]   =   vy * inverse;
+            ny[j]   = - vx * inverse;
+            nz[j]   = 0.f;
+            k[j]    = product * inverse * inverse * inverse;
+        };
+    };
+
+    return;
+}
+
+/******************************************************************************/
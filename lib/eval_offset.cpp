@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Evaluate offset curves of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        eval_offset.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * An offset curve, also known as parallel curve, consists of all points at a
+ * certain normal distance to the ellipse.  In contrast to the `offset` of
+ * `eval`, which shifts the parameter value, the distance is a geometric one.
+ * Offset curves are required for tool paths, stroke outlines and safety
+ * margins.
+ *
+ * Positive distances lead to outer offsets, negative distances to inner ones.
+ * Please note that inner offsets might contain cusps and loops.  These are
+ * removed by the tessellation of offset curves, only.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Evaluate an offset curve of this ellipse.
+ * \param   t           The parameter value to evaluate the offset curve for.
+ * \param   distance    The signed normal distance to the ellipse.
+ * \return  The evaluated point of the offset curve.
+ *
+ * The curve point is moved along the outward unit normal by `distance`.  The
+ * returned vector contains the x, y and z coordinates in this order.
+ */
+
+ELLIPSE_INLINE vector <float> Ellipse :: eval_offset
+    ( const float t
+    , const float distance
+    ) const
+{
+    ELLIPSE_COUNT ("eval_offset");
+    ELLIPSE_ALLOCATE (0x3 * sizeof (float));
+
+    vector <float>  ret (0x3);
+
+    this -> eval_offset
+        (& t, 0x1, & distance, 0x1, & ret[0x0], & ret[0x1], & ret[0x2]);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Evaluate several offset curves of this ellipse for a batch.
+ * \param   t           The parameter values to evaluate the curves for.
+ * \param   count       The count of parameter values.
+ * \param   distances   The signed normal distances of the offset curves.
+ * \param   offsets     The count of distances.
+ * \param   x           The x coordinates of the evaluated points.
+ * \param   y           The y coordinates of the evaluated points.
+ * \param   z           The z coordinates of the evaluated points.
+ *
+ * The output arrays need to provide space for `count * offsets` elements.  The
+ * point of parameter value `i` on offset curve `j` is stored at index
+ * `j * count + i`.
+ *
+ * The parameter values are processed in blocks.  Curve points and normals of a
+ * block are computed once and then reused for all distances such that sine
+ * and cosine are evaluated only once per parameter value.  They are computed
+ * by the C standard library.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_offset  ( const float * t
+                                            , const size_t count
+                                            , const float * distances
+                                            , const size_t offsets
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            ) const
+{
+    this -> eval_offset (t, count, distances, offsets, x, y, z, Trig ());
+    return;
+}
+
+
+
+/**
+ * \brief   Evaluate several offset curves of this ellipse for a batch.
+ * \param   t           The parameter values to evaluate the curves for.
+ * \param   count       The count of parameter values.
+ * \param   distances   The signed normal distances of the offset curves.
+ * \param   offsets     The count of distances.
+ * \param   x           The x coordinates of the evaluated points.
+ * \param   y           The y coordinates of the evaluated points.
+ * \param   z           The z coordinates of the evaluated points.
+ * \param   trig        The backend computing the sines and the cosines.
+ *
+ * The sines and cosines of each block are computed by the given backend before
+ * the curve points and normals of the block are determined.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_offset  ( const float * t
+                                            , const size_t count
+                                            , const float * distances
+                                            , const size_t offsets
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            , const Trig & trig
+                                            ) const
+{
+    ELLIPSE_COUNT ("eval_offset (batch)");
+    ELLIPSE_TIME ("eval_offset (batch)");
+
+    const size_t    block   {0x100};
+    const float     major   {this -> major};
+    const float     minor   {this -> minor};
+
+    float   cosine  [block];
+    float   sine    [block];
+    float   px      [block];
+    float   py      [block];
+    float   nx      [block];
+    float   ny      [block];
+
+    for (size_t begin = 0x0; begin < count; begin += block)
+    {
+        const size_t    size    {count - begin < block ? count - begin : block};
+
+        trig.sincos (t + begin, size, sine, cosine);
+
+#pragma omp simd
+        for (size_t i = 0x0; i < size; i++)
+        {
+            const float c       {cosine[i]};
+            const float s       {sine[i]};
+            const float vx      {- major * s};
+            const float vy      {minor * c};
+            const float speed   {sqrt (vx * vx + vy * vy)};
+            const float inverse {speed > 0.f ? 1.f / speed : 0.f};
+
+            px[i]   = major * c;
+            py[i]   = minor * s;
+            nx[i]   =   vy * inverse;
+            ny[i]   = - vx * inverse;
+        };
+
+        for (size_t j = 0x0; j < offsets; j++)
+        {
+            const float     d       {distances[j]};
+            const size_t    first   {j * count + begin};
+
+#pragma omp simd
+            for (size_t i = 0x0; i < size; i++)
+            {
+                x[first + i]    = px[i] + d * nx[i];
+                y[first + i]    = py[i] + d * ny[i];
+                z[first + i]    = 0.f;
+            };
+        };
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Evaluate the considered ellipse in world coordinates.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        eval_world.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The other evaluation methods return curve points within the local frame of
+ * the ellipse, i.e. relative to its centre and along its semi-axes.  Snapping,
+ * picking and the inverse parametrisation by `parameter_of` work on placed
+ * points, instead, which are defined by this file.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Evaluate this ellipse in world coordinates.
+ * \param   t   The parameter value to evaluate this ellipse for.
+ * \return  The x, y and z coordinates of the placed curve point.
+ *
+ * This overload calls the batch overload for a single parameter value.
+ */
+
+ELLIPSE_INLINE vector <float> Ellipse :: eval_world (const float t) const
+{
+    ELLIPSE_COUNT ("eval_world");
+    ELLIPSE_ALLOCATE (0x3 * sizeof (float));
+
+    vector <float>  ret (0x3);
+
+    this -> eval_world (& t, 0x1, & ret[0x0], & ret[0x1], & ret[0x2], Trig ());
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Evaluate this ellipse in world coordinates for a batch.
+ * \param   t       The parameter values to evaluate this ellipse for.
+ * \param   count   The count of parameter values.
+ * \param   x       The x coordinates of the placed curve points.
+ * \param   y       The y coordinates of the placed curve points.
+ * \param   z       The z coordinates of the placed curve points.
+ *
+ * The sines and cosines are computed by the C standard library.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_world   ( const float * t
+                                            , const size_t count
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            ) const
+{
+    this -> eval_world (t, count, x, y, z, Trig ());
+    return;
+}
+
+
+
+/**
+ * \brief   Evaluate this ellipse in world coordinates for a batch.
+ * \param   t       The parameter values to evaluate this ellipse for.
+ * \param   count   The count of parameter values.
+ * \param   x       The x coordinates of the placed curve points.
+ * \param   y       The y coordinates of the placed curve points.
+ * \param   z       The z coordinates of the placed curve points.
+ * \param   trig    The backend computing the sines and the cosines.
+ *
+ * The curve point of parameter `t` is the centre plus `a cos t` along the
+ * first and `b sin t` along the second unit vector of `basis`.  These are the
+ * coordinates `place` maps tessellated shapes to as well as the coordinates
+ * `parameter_of` expects, such that `parameter_of` inverts this method up to
+ * the accuracy stated there.  The sines and cosines of blocks of 256 parameter
+ * values are computed by the given backend at first.  Then, the coordinates
+ * are determined in SIMD lanes.
+ */
+
+ELLIPSE_INLINE void Ellipse :: eval_world   ( const float * t
+                                            , const size_t count
+                                            , float * x
+                                            , float * y
+                                            , float * z
+                                            , const Trig & trig
+                                            ) const
+{
+    ELLIPSE_COUNT ("eval_world (batch)");
+    ELLIPSE_TIME ("eval_world (batch)");
+
+    const size_t    block   {0x100};
+
+    double  frame   [0x2][0x3]  {};
+
+    this -> basis (frame[0x0], frame[0x1]);
+
+    const float cx  {this -> centre[0x0]};
+    const float cy  {this -> centre[0x1]};
+    const float cz  {this -> centre[0x2]};
+    const float ux  {float (frame[0x0][0x0]) * this -> major};
+    const float uy  {float (frame[0x0][0x1]) * this -> major};
+    const float uz  {float (frame[0x0][0x2]) * this -> major};
+    const float vx  {float (frame[0x1][0x0]) * this -> minor};
+    const float vy  {float (frame[0x1][0x1]) * this -> minor};
+    const float vz  {float (frame[0x1][0x2]) * this -> minor};
+
+    float   cosine  [block];
+    float   sine    [block];
+
+    for (size_t begin = 0x0; begin < count; begin += block)
+    {
+        const size_t    size    {count - begin < block ? count - begin : block};
+
+        trig.sincos (t + begin, size, sine, cosine);
+
+#pragma omp simd
+        for (size_t i = 0x0; i < size; i++)
+        {
+            x[begin + i]    = cx + cosine[i] * ux + sine[i] * vx;
+            y[begin + i]    = cy + cosine[i] * uy + sine[i] * vy;
+            z[begin + i]    = cz + cosine[i] * uz + sine[i] * vz;
+        };
+    };
+
+    return;
+}
+
+/******************************************************************************/
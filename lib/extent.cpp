@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Determine the extent of the considered ellipse within its plane.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        extent.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The extent is the half size of the axis-aligned bounding box of the ellipse
+ * as it is placed within the x-y plane by its centre and tangent.  It is
+ * required in order to skip the ellipse quickly where it cannot contribute, for
+ * instance when rasterising.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Determine the extent of this ellipse within its plane.
+ * \param   width   The half width of the bounding box.
+ * \param   height  The half height of the bounding box.
+ *
+ * The major axis is assumed to point into the direction of the tangent's
+ * projection onto the x-y plane.  In case this projection vanishes, the major
+ * axis is parallel to the x axis.
+ *
+ * In case the derived data of this ellipse is valid, the stored extent is
+ * returned.
+ */
+
+ELLIPSE_INLINE void Ellipse :: extent (float & width, float & height) const
+{
+    if (this -> cache ())
+    {
+        width   = this -> derived.width;
+        height  = this -> derived.height;
+        return;
+    };
+
+    const double    tx      {this -> tangent[0x0]};
+    const double    ty      {this -> tangent[0x1]};
+    const double    norm    {sqrt (tx * tx + ty * ty)};
+    const double    c       {norm > 0. ? tx / norm : 1.};
+    const double    s       {norm > 0. ? ty / norm : 0.};
+    const double    a       {this -> major};
+    const double    b       {this -> minor};
+
+    width   = float (sqrt (a * a * c * c + b * b * s * s));
+    height  = float (sqrt (a * a * s * s + b * b * c * c));
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Convert conics into ellipses.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        from_conic.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Algorithms working on the implicit form, such as projections or fittings,
+ * result in conics.  This file defines their conversion back into ellipses,
+ * both for single conics and for whole batches.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Convert a conic into an ellipse.
+ * \param   conic   The conic to convert.
+ * \param   ellipse The resulting ellipse.
+ * \return  Whether the conic is a real ellipse.
+ *
+ * The ellipse is placed within the x-y plane.  Its normal is the z axis and
+ * its tangent points into the direction of the major axis.  In case the conic
+ * is not a real ellipse, `ellipse` is not changed.
+ */
+
+ELLIPSE_INLINE
+bool Ellipse :: from_conic (const Conic & conic, Ellipse & ellipse)
+{
+    ELLIPSE_COUNT ("from_conic");
+
+    double  p   [0x5]   {};
+
+    if (! conic.parameters (p[0x0], p[0x1], p[0x2], p[0x3], p[0x4]))
+        return false;
+
+    ellipse = Ellipse   ( float (p[0x3])
+                        , float (p[0x2] - p[0x3])
+                        , float (p[0x0])
+                        , float (p[0x1])
+                        , 0.f
+                        , float (cos (p[0x4]))
+                        , float (sin (p[0x4]))
+                        , 0.f
+                        , 0.f
+                        , 0.f
+                        , 1.f
+                        );
+
+    return true;
+}
+
+
+
+/**
+ * \brief   Convert a batch of conics into ellipses.
+ * \param   conics      The conics to convert.
+ * \param   count       The count of conics.
+ * \param   ellipses    The resulting ellipses.
+ * \return  The count of conics which are real ellipses.
+ *
+ * The ellipses are placed as by the other overload.  All values of the
+ * ellipses whose conics are not real ellipses are set to zero.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: from_conic   ( const Conic * conics
+                                              , const size_t count
+                                              , const Batch & ellipses
+                                              )
+{
+    ELLIPSE_COUNT ("from_conic (batch)");
+    ELLIPSE_TIME ("from_conic (batch)");
+
+    size_t  ret {0x0};
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        double      p       [0x5]   {};
+        const bool  valid
+            {conics[i].parameters (p[0x0], p[0x1], p[0x2], p[0x3], p[0x4])};
+
+        Ellipse :: store (ellipses, i, valid, p);
+        ret += valid;
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -48,7 +48,10 @@
 
 % Software.
 software.compiler.self  = ' g++ ';
-software.compiler.flags = ' -Wall -Werror -Wextra -Wpedantic -std=c++11 -c ';
+software.compiler.flags = ' -Wall -Werror -Wextra -Wpedantic -std=c++11 ';
+software.compiler.flags = [software.compiler.flags ' -O2 -fopenmp-simd -c '];
+software.compiler.flags = [software.compiler.flags ' -fno-math-errno '];
+software.compiler.flags = [software.compiler.flags ' -fno-trapping-math '];
 software.compiler.call  = [software.compiler.self software.compiler.flags];
 
 
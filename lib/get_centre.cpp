@@ -48,9 +48,12 @@
  * this method.
  */
 
-inline vector <float> Ellipse :: get_centre (void)
+ELLIPSE_INLINE vector <float> Ellipse :: get_centre (void)
 {
-    return this -> centre;
+    ELLIPSE_COUNT ("get_centre");
+    ELLIPSE_ALLOCATE (this -> centre.size () * sizeof (float));
+
+    return vector <float> (this -> centre.begin (), this -> centre.end ());
 }
 
 /******************************************************************************/
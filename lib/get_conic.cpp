@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The getter method for the conic of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        get_conic.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The implicit form of an ellipse is required by many algorithms, such as
+ * containment tests and intersections.  It is either computed on demand or
+ * returned from the derived data of the ellipse.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   The getter method for the implicit form of this ellipse.
+ * \return  This ellipse's conic.
+ *
+ * The conic describes this ellipse within the x-y plane as it is placed by its
+ * centre and the direction of its tangent, which is the same placement as for
+ * the rasterisation.  It is not normalised such that it evaluates to `-1` at
+ * the centre.
+ *
+ * In case the derived data of this ellipse is valid, the stored conic is
+ * returned.  Otherwise, it is computed from the geometry.
+ */
+
+ELLIPSE_INLINE Conic Ellipse :: get_conic (void) const
+{
+    ELLIPSE_COUNT ("get_conic");
+
+    if (this -> cache ())
+        return this -> derived.conic;
+
+    return Conic :: from_parameters
+        ( this -> centre[0x0]
+        , this -> centre[0x1]
+        , this -> major
+        , this -> minor
+        , std :: atan2 (this -> tangent[0x1], this -> tangent[0x0])
+        );
+}
+
+/******************************************************************************/
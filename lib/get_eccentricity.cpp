@@ -48,8 +48,10 @@
  * using this method.
  */
 
-inline float Ellipse :: get_eccentricity (void)
+ELLIPSE_INLINE float Ellipse :: get_eccentricity (void)
 {
+    ELLIPSE_COUNT ("get_eccentricity");
+
     return this -> eccentricity;
 }
 
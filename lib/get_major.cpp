@@ -48,8 +48,10 @@
  * this method.
  */
 
-inline float Ellipse :: get_major (void)
+ELLIPSE_INLINE float Ellipse :: get_major (void)
 {
+    ELLIPSE_COUNT ("get_major");
+
     return this -> major;
 }
 
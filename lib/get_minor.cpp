@@ -48,8 +48,10 @@
  * this method.
  */
 
-inline float Ellipse :: get_minor (void)
+ELLIPSE_INLINE float Ellipse :: get_minor (void)
 {
+    ELLIPSE_COUNT ("get_minor");
+
     return this -> minor;
 }
 
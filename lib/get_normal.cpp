@@ -48,9 +48,12 @@
  * this method.
  */
 
-inline vector <float> Ellipse :: get_normal (void)
+ELLIPSE_INLINE vector <float> Ellipse :: get_normal (void)
 {
-    return this -> normal;
+    ELLIPSE_COUNT ("get_normal");
+    ELLIPSE_ALLOCATE (this -> normal.size () * sizeof (float));
+
+    return vector <float> (this -> normal.begin (), this -> normal.end ());
 }
 
 /******************************************************************************/
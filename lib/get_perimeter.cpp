@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The getter method for the perimeter of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        get_perimeter.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The perimeter of an ellipse is an elliptic integral of the second kind which
+ * has no closed form.  Instead, Ramanujan's second approximation is used which
+ * is accurate for moderate aspect ratios and cheap to evaluate.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   The getter method for the perimeter of this ellipse.
+ * \return  This ellipse's approximate perimeter.
+ *
+ * With `h = ((a - b) / (a + b))^2`, the perimeter is approximated by
+ * `pi (a + b) (1 + 3h / (10 + sqrt (4 - 3h)))`.  The relative error is less
+ * than 1e-9 for an aspect ratio of 2, about 1e-5 for an aspect ratio of 10 and
+ * at most 4e-4 for degenerate ellipses.
+ *
+ * In case the derived data of this ellipse is valid, the stored perimeter is
+ * returned.
+ */
+
+ELLIPSE_INLINE float Ellipse :: get_perimeter (void) const
+{
+    ELLIPSE_COUNT ("get_perimeter");
+
+    if (this -> cache ())
+        return this -> derived.perimeter;
+
+    const double    a   {abs (this -> major)};
+    const double    b   {abs (this -> minor)};
+    const double    sum {a + b};
+
+    if (sum <= 0.)
+        return 0.f;
+
+    const double    h   {(a - b) * (a - b) / (sum * sum)};
+
+    return float    ( 3.141592653589793 * sum
+                    * (1. + 3. * h / (10. + sqrt (4. - 3. * h)))
+                    );
+}
+
+/******************************************************************************/
@@ -48,8 +48,10 @@
  * this method.
  */
 
-inline float Ellipse :: get_radius (void)
+ELLIPSE_INLINE float Ellipse :: get_radius (void)
 {
+    ELLIPSE_COUNT ("get_radius");
+
     return this -> radius;
 }
 
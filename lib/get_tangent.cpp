@@ -48,9 +48,12 @@
  * this method.
  */
 
-inline vector <float> Ellipse :: get_tangent (void)
+ELLIPSE_INLINE vector <float> Ellipse :: get_tangent (void)
 {
-    return this -> tangent;
+    ELLIPSE_COUNT ("get_tangent");
+    ELLIPSE_ALLOCATE (this -> tangent.size () * sizeof (float));
+
+    return vector <float> (this -> tangent.begin (), this -> tangent.end ());
 }
 
 /******************************************************************************/
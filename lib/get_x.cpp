@@ -48,8 +48,10 @@
  * method.
  */
 
-inline function <float (const float)> Ellipse :: get_x (void)
+ELLIPSE_INLINE function <float (const float)> Ellipse :: get_x (void)
 {
+    ELLIPSE_COUNT ("get_x");
+
     return this -> x;
 }
 
@@ -48,8 +48,10 @@
  * method.
  */
 
-inline function <float (const float)> Ellipse :: get_y (void)
+ELLIPSE_INLINE function <float (const float)> Ellipse :: get_y (void)
 {
+    ELLIPSE_COUNT ("get_y");
+
     return this -> y;
 }
 
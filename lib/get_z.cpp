@@ -48,8 +48,10 @@
  * method.
  */
 
-inline function <float (const float)> Ellipse :: get_z (void)
+ELLIPSE_INLINE function <float (const float)> Ellipse :: get_z (void)
 {
+    ELLIPSE_COUNT ("get_z");
+
     return this -> z;
 }
 
@@ -44,20 +44,30 @@
  * \brief   Initialise the held vectors.
  *
  * When creating a new ellipse from scratch, the held vectors will not contain
- * any elements, yet.  In order to avoid unintended side effects from this fact,
- * this function will assign initial elements to them.
+ * meaningful elements, yet.  In order to avoid unintended side effects from
+ * this fact, this function will assign initial elements to them.  The vectors
+ * are stored within the object itself such that creating an ellipse does not
+ * allocate memory.
+ *
+ * The scalars are zeroed first since the setters keep them consistent with
+ * each other.  A new ellipse does not cache its derived data.
  */
 
-void Ellipse :: init (void)
+ELLIPSE_INLINE void Ellipse :: init (void)
 {
-    this -> centre  = vector <float> (0x3);
-    this -> normal  = vector <float> (0x3);
-    this -> tangent = vector <float> (0x3);
+    this -> caching         = Ellipse :: none;
+    this -> cached          = false;
+    this -> eccentricity    = 0.f;
+    this -> major           = 0.f;
+    this -> minor           = 0.f;
+    this -> radius          = 0.f;
 
     this -> set_centre ();
     this -> set_normal ();
     this -> set_tangent ();
 
+    this -> z   = [] (const float t) -> float {return 0.f * t;};
+
     return;
 }
 
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Intersect rays with the disk of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        intersect_disk.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Picking and visibility tests shoot rays at the region enclosed by an ellipse
+ * in space.  This file defines the exact intersection of batches of rays with
+ * this region.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Intersect a batch of rays with the disk of this ellipse.
+ * \param   rays        The rays to intersect.
+ * \param   count       The count of rays.
+ * \param   distance    The ray parameters of the hits.
+ * \return  The count of rays hitting the disk.
+ *
+ * The disk is the region enclosed by this ellipse within its plane.  For each
+ * ray, the plane is hit at the ray parameter `s = n . (c - o) / n . d` where
+ * `n` is the unit normal of the plane, `c` the centre, `o` the origin and `d`
+ * the direction of the ray.  The hit point is inside the disk in case its
+ * coordinates `(x, y)` within the local frame satisfy
+ * `(x / a)^2 + (y / b)^2 <= 1`.
+ *
+ * The hit point is `o + s d`.  Rays which are parallel to the plane, start
+ * behind it or pass the disk are assigned an infinite distance.  The frame is
+ * taken from the derived data of this ellipse in case it is valid.  Then, the
+ * rays are processed in SIMD lanes.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: intersect_disk   ( const Rays & rays
+                                                  , const size_t count
+                                                  , float * distance
+                                                  ) const
+{
+    ELLIPSE_COUNT ("intersect_disk (batch)");
+    ELLIPSE_TIME ("intersect_disk (batch)");
+
+    double  u   [0x3]   {};
+    double  v   [0x3]   {};
+
+    this -> basis (u, v);
+
+    const float     ux  {float (u[0x0] / this -> major)};
+    const float     uy  {float (u[0x1] / this -> major)};
+    const float     uz  {float (u[0x2] / this -> major)};
+    const float     vx  {float (v[0x0] / this -> minor)};
+    const float     vy  {float (v[0x1] / this -> minor)};
+    const float     vz  {float (v[0x2] / this -> minor)};
+    const float     nx  {float (u[0x1] * v[0x2] - u[0x2] * v[0x1])};
+    const float     ny  {float (u[0x2] * v[0x0] - u[0x0] * v[0x2])};
+    const float     nz  {float (u[0x0] * v[0x1] - u[0x1] * v[0x0])};
+    const float     cx  {this -> centre[0x0]};
+    const float     cy  {this -> centre[0x1]};
+    const float     cz  {this -> centre[0x2]};
+    const float *   ox  {rays.origin[0x0]};
+    const float *   oy  {rays.origin[0x1]};
+    const float *   oz  {rays.origin[0x2]};
+    const float *   dx  {rays.direction[0x0]};
+    const float *   dy  {rays.direction[0x1]};
+    const float *   dz  {rays.direction[0x2]};
+    size_t          ret {0x0};
+
+#pragma omp simd reduction (+ : ret)
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const float denominator {nx * dx[i] + ny * dy[i] + nz * dz[i]};
+        const float px          {cx - ox[i]};
+        const float py          {cy - oy[i]};
+        const float pz          {cz - oz[i]};
+        const float s
+            {(nx * px + ny * py + nz * pz) / denominator};
+        const float hx          {ox[i] + s * dx[i] - cx};
+        const float hy          {oy[i] + s * dy[i] - cy};
+        const float hz          {oz[i] + s * dz[i] - cz};
+        const float x           {ux * hx + uy * hy + uz * hz};
+        const float y           {vx * hx + vy * hy + vz * hz};
+        const bool  hit
+            {denominator != 0.f && s >= 0.f && x * x + y * y <= 1.f};
+
+        distance[i] = hit ? s : INFINITY;
+        ret += hit;
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
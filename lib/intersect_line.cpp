@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Intersect lines with the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        intersect_line.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Clipping and picking within the plane of an ellipse require the points where
+ * a line crosses the ellipse.  This file defines their exact computation for
+ * batches of lines.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Intersect a batch of lines with this ellipse.
+ * \param   lines   The lines to intersect.
+ * \param   count   The count of lines.
+ * \param   first   The parameters of the first intersections.
+ * \param   second  The parameters of the second intersections.
+ * \return  The count of lines intersecting this ellipse.
+ *
+ * The lines are expected to lie within the plane of this ellipse, otherwise
+ * their orthogonal projections onto the plane are intersected.  Within the
+ * local frame scaled by the semi-axes, the ellipse becomes the unit circle and
+ * the line `(x + s dx, y + s dy)`.  The line parameters `s` of the
+ * intersections solve the quadratic equation
+ * `(dx^2 + dy^2) s^2 + 2 (x dx + y dy) s + x^2 + y^2 - 1 = 0`.
+ *
+ * For each intersection, the parameter of this ellipse is the angle of
+ * `(x + s dx, y + s dy)` within `[-pi, pi]`, as computed by `Trig :: angle`.
+ * The intersections are ordered by their line parameters, such that `first`
+ * is hit before `second` when following the direction of the line.  For
+ * tangent lines, both parameters coincide.  Lines which miss this ellipse are
+ * assigned NaN.  The lines are processed in SIMD lanes.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: intersect_line   ( const Rays & lines
+                                                  , const size_t count
+                                                  , float * first
+                                                  , float * second
+                                                  ) const
+{
+    ELLIPSE_COUNT ("intersect_line (batch)");
+    ELLIPSE_TIME ("intersect_line (batch)");
+
+    double  u   [0x3]   {};
+    double  v   [0x3]   {};
+
+    this -> basis (u, v);
+
+    const float     ux  {float (u[0x0] / this -> major)};
+    const float     uy  {float (u[0x1] / this -> major)};
+    const float     uz  {float (u[0x2] / this -> major)};
+    const float     vx  {float (v[0x0] / this -> minor)};
+    const float     vy  {float (v[0x1] / this -> minor)};
+    const float     vz  {float (v[0x2] / this -> minor)};
+    const float     cx  {this -> centre[0x0]};
+    const float     cy  {this -> centre[0x1]};
+    const float     cz  {this -> centre[0x2]};
+    const float *   ox  {lines.origin[0x0]};
+    const float *   oy  {lines.origin[0x1]};
+    const float *   oz  {lines.origin[0x2]};
+    const float *   dx  {lines.direction[0x0]};
+    const float *   dy  {lines.direction[0x1]};
+    const float *   dz  {lines.direction[0x2]};
+    size_t          ret {0x0};
+
+#pragma omp simd reduction (+ : ret)
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const float px  {ox[i] - cx};
+        const float py  {oy[i] - cy};
+        const float pz  {oz[i] - cz};
+        const float x   {ux * px + uy * py + uz * pz};
+        const float y   {vx * px + vy * py + vz * pz};
+        const float sx  {ux * dx[i] + uy * dy[i] + uz * dz[i]};
+        const float sy  {vx * dx[i] + vy * dy[i] + vz * dz[i]};
+        const float a   {sx * sx + sy * sy};
+        const float b   {x * sx + y * sy};
+        const float c   {x * x + y * y - 1.f};
+        const float d   {b * b - a * c};
+        const bool  hit {a > 0.f && d >= 0.f};
+        const float r   {sqrt (hit ? d : 0.f)};
+        const float s0  {(- b - r) / (hit ? a : 1.f)};
+        const float s1  {(- b + r) / (hit ? a : 1.f)};
+
+        const float t0  {Trig :: angle (y + s0 * sy, x + s0 * sx)};
+        const float t1  {Trig :: angle (y + s1 * sy, x + s1 * sx)};
+
+        first[i]    = hit ? t0 : NAN;
+        second[i]   = hit ? t1 : NAN;
+        ret += hit;
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
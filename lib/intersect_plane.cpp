@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Intersect the considered ellipse with planes.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        intersect_plane.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Clipping an ellipse against the planes of a view frustum or a section
+ * requires the parameters where the ellipse crosses the planes.  This file
+ * defines their exact computation for batches of planes.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Intersect this ellipse with a batch of planes.
+ * \param   planes  The planes to intersect.
+ * \param   count   The count of planes.
+ * \param   first   The parameters of the first intersections.
+ * \param   second  The parameters of the second intersections.
+ * \return  The count of planes intersecting this ellipse.
+ *
+ * The curve point `c + a cos (t) u + b sin (t) v` lies in the plane
+ * `n . p = offset` in case `A cos (t) + B sin (t) = C` with `A = a n . u`,
+ * `B = b n . v` and `C = offset - n . c`.  With `R = sqrt (A^2 + B^2)` and
+ * `phi` the angle of `(A, B)`, this is `cos (t - phi) = C / R` such that the
+ * solutions are `t = phi -+ acos (C / R)`.  Both angles are computed by
+ * `Trig :: angle`, the latter as the angle of `(C, sqrt (R^2 - C^2))`.
+ *
+ * Planes which are parallel to the plane of this ellipse or which do not reach
+ * it are assigned NaN.  For tangent planes, both parameters coincide.  The
+ * frame is taken from the derived data of this ellipse in case it is valid.
+ * Then, the planes are processed in SIMD lanes.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: intersect_plane  ( const Planes & planes
+                                                  , const size_t count
+                                                  , float * first
+                                                  , float * second
+                                                  ) const
+{
+    ELLIPSE_COUNT ("intersect_plane (batch)");
+    ELLIPSE_TIME ("intersect_plane (batch)");
+
+    double  u   [0x3]   {};
+    double  v   [0x3]   {};
+
+    this -> basis (u, v);
+
+    const float     ux  {float (u[0x0] * this -> major)};
+    const float     uy  {float (u[0x1] * this -> major)};
+    const float     uz  {float (u[0x2] * this -> major)};
+    const float     vx  {float (v[0x0] * this -> minor)};
+    const float     vy  {float (v[0x1] * this -> minor)};
+    const float     vz  {float (v[0x2] * this -> minor)};
+    const float     cx  {this -> centre[0x0]};
+    const float     cy  {this -> centre[0x1]};
+    const float     cz  {this -> centre[0x2]};
+    const float *   nx  {planes.normal[0x0]};
+    const float *   ny  {planes.normal[0x1]};
+    const float *   nz  {planes.normal[0x2]};
+    const float *   d   {planes.offset};
+    size_t          ret {0x0};
+
+#pragma omp simd reduction (+ : ret)
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const float a       {nx[i] * ux + ny[i] * uy + nz[i] * uz};
+        const float b       {nx[i] * vx + ny[i] * vy + nz[i] * vz};
+        const float c       {d[i] - nx[i] * cx - ny[i] * cy - nz[i] * cz};
+        const float r       {sqrt (a * a + b * b)};
+        const bool  hit     {abs (c) <= r && r > 0.f};
+        const float phi     {Trig :: angle (b, a)};
+        const float square  {r * r - c * c};
+        const float h       {sqrt (square > 0.f ? square : 0.f)};
+        const float delta   {Trig :: angle (h, c)};
+
+        first[i]    = hit ? phi - delta : NAN;
+        second[i]   = hit ? phi + delta : NAN;
+        ret += hit;
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
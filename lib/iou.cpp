@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The intersection over union of two ellipses.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        iou.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Detectors are evaluated and deduplicated by the intersection over union of
+ * their outputs.  This file defines this ratio for two ellipses within the x-y
+ * plane.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   The intersection over union with another ellipse.
+ * \param   other   The other ellipse.
+ * \return  The ratio of the areas of the intersection and the union.
+ *
+ * Both ellipses are regarded within the x-y plane, as for `overlap`.  The
+ * ratio is zero in case both ellipses are degenerate.
+ */
+
+ELLIPSE_INLINE float Ellipse :: iou (const Ellipse & other) const
+{
+    ELLIPSE_COUNT ("iou");
+
+    const Planar    first   {this -> planar ()};
+    const Planar    second  {other.planar ()};
+    const double    common  {Ellipse :: overlap (first, second)};
+    const double    total
+        { 3.141592653589793 * first.major * first.minor
+        + 3.141592653589793 * second.major * second.minor
+        - common
+        };
+
+    return total > 0. ? float (common / total) : 0.f;
+}
+
+/******************************************************************************/
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Solve Kepler's equation.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kepler.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The position of a body on an elliptic orbit at a certain time is given by its
+ * eccentric anomaly `E`, which is the parameter of the ellipse's evaluation.
+ * Time enters via the mean anomaly `M` which grows linearly.  Both are related
+ * by Kepler's equation `M = E - e sin E` which needs to be solved numerically
+ * for `E`.
+ *
+ * This file defines a scalar solver and a batch solver whose iterations are
+ * processed in SIMD lanes.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Solve Kepler's equation for a single mean anomaly.
+ * \param   mean            The mean anomaly.
+ * \param   eccentricity    The numerical eccentricity of the orbit.
+ * \return  The eccentric anomaly.
+ *
+ * This overload calls the batch overload for a single mean anomaly.  See there
+ * for the details and the accuracy.
+ */
+
+ELLIPSE_INLINE float Ellipse :: kepler  ( const float mean
+                                        , const float eccentricity
+                                        )
+{
+    ELLIPSE_COUNT ("kepler");
+
+    float   anomaly {};
+    float   sine    {};
+    float   cosine  {};
+
+    Ellipse :: kepler
+        (& mean, & eccentricity, 0x1, & anomaly, & sine, & cosine);
+
+    return anomaly;
+}
+
+
+
+/**
+ * \brief   Solve Kepler's equation for a batch of mean anomalies.
+ * \param   mean            The mean anomalies.
+ * \param   eccentricity    The numerical eccentricities of the orbits.
+ * \param   count           The count of mean anomalies.
+ * \param   anomaly         The eccentric anomalies.
+ *
+ * Each mean anomaly is paired with the eccentricity at the same index such
+ * that bodies on different orbits can be solved within the same batch.  The
+ * eccentricities need to be within `[0, 1)`.  `anomaly` may refer to the same
+ * array as `mean`.
+ *
+ * The mean anomalies are processed in blocks of 256 values.  See the private
+ * overload for the method and the accuracy.
+ */
+
+ELLIPSE_INLINE void Ellipse :: kepler ( const float * mean
+                                      , const float * eccentricity
+                                      , const size_t count
+                                      , float * anomaly
+                                      )
+{
+    ELLIPSE_COUNT ("kepler (batch)");
+    ELLIPSE_TIME ("kepler (batch)");
+
+    const size_t    block   {0x100};
+
+    float   sine    [block];
+    float   cosine  [block];
+
+    for (size_t begin = 0x0; begin < count; begin += block)
+        Ellipse :: kepler   ( mean + begin
+                            , eccentricity + begin
+                            , count - begin < block ? count - begin : block
+                            , anomaly + begin
+                            , sine
+                            , cosine
+                            );
+
+    return;
+}
+
+
+
+/**
+ * \brief   Solve Kepler's equation for a block of mean anomalies.
+ * \param   mean            The mean anomalies.
+ * \param   eccentricity    The numerical eccentricities of the orbits.
+ * \param   count           The count of mean anomalies.
+ * \param   anomaly         The eccentric anomalies.
+ * \param   sine            The sines of the eccentric anomalies.
+ * \param   cosine          The cosines of the eccentric anomalies.
+ *
+ * The equation is solved for the difference `d = E - M` which lies within
+ * `[-e, e]`.  Hence, the sine and the cosine of `E` follow from those of `M`
+ * by the addition theorems, with the sine and the cosine of `d` approximated
+ * by their Taylor polynomials of degree 9 and 10.  On `[-1, 1]`, these are
+ * accurate to 3e-8, which is below the resolution of `float`.  Thus, only one
+ * sine and one cosine of `M` need to be evaluated per value.  They are computed
+ * by the `polynomial` backend of `Trig` of degree seven, whose error of 1.9e-7
+ * is close to the one of the C standard library, such that the whole solver is
+ * processed in SIMD lanes.  Its argument reduction is exact for mean anomalies
+ * of moderate magnitude, which should be reduced to `[-pi, pi]` beforehand.
+ *
+ * The iteration starts at `d = e sin M / (1 - e cos M)`, clamped to
+ * `[-e, e]`.  Then, three iterations of Halley's method are applied, which
+ * leaves a residual of Kepler's equation of less than 1e-6 for all
+ * eccentricities up to 0.99 and all mean anomalies.  Since Halley's method
+ * converges cubically, the first two iterations only use the Taylor
+ * polynomials of degree 5 and 6, whose error of 2e-4 is removed by the last
+ * one.  The sine and the cosine of
+ * the result are returned, as well, since the position on the orbit is
+ * usually required next.
+ */
+
+ELLIPSE_INLINE void Ellipse :: kepler ( const float * mean
+                                      , const float * eccentricity
+                                      , const size_t count
+                                      , float * anomaly
+                                      , float * sine
+                                      , float * cosine
+                                      )
+{
+    // The Taylor polynomials of the sine and the cosine in Horner's form,
+    // multiplying by the reciprocal coefficients instead of dividing.
+    const auto  taylor  = [] (const float d, float & s, float & c) -> void
+    {
+        const float d2  {d * d};
+
+        s   = d * (1.f - d2 * (1.f / 6.f) * (1.f - d2 * (1.f / 20.f)
+            * (1.f - d2 * (1.f / 42.f) * (1.f - d2 * (1.f / 72.f)))));
+        c   = 1.f - d2 * 0.5f * (1.f - d2 * (1.f / 12.f)
+            * (1.f - d2 * (1.f / 30.f) * (1.f - d2 * (1.f / 56.f)
+            * (1.f - d2 * (1.f / 90.f)))));
+
+        return;
+    };
+
+    // The Taylor polynomials of degree 5 and 6 for the first iterations.
+    const auto  coarse  = [] (const float d, float & s, float & c) -> void
+    {
+        const float d2  {d * d};
+
+        s   = d * (1.f - d2 * (1.f / 6.f) * (1.f - d2 * (1.f / 20.f)));
+        c   = 1.f - d2 * 0.5f * (1.f - d2 * (1.f / 12.f)
+            * (1.f - d2 * (1.f / 30.f)));
+
+        return;
+    };
+
+    Trig (Trig :: polynomial, 0x7).sincos (mean, count, sine, cosine);
+
+#pragma omp simd
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const float e       {eccentricity[i]};
+        const float sm      {sine[i]};
+        const float cm      {cosine[i]};
+        const float start   {e * sm / (1.f - e * cm)};
+
+        float   d   {start > e ? e : start < - e ? - e : start};
+        float   sd  {};
+        float   cd  {};
+
+        // One iteration of Halley's method, given the sine and the cosine of
+        // the current difference.
+        const auto  halley  = [&] (void) -> void
+        {
+
+            const float se  {sm * cd + cm * sd};
+            const float ce  {cm * cd - sm * sd};
+            const float f   {d - e * se};
+            const float df  {1.f - e * ce};
+
+            d -= f * df / (df * df - 0.5f * f * e * se);
+            return;
+        };
+
+        coarse (d, sd, cd);
+        halley ();
+        coarse (d, sd, cd);
+        halley ();
+        taylor (d, sd, cd);
+        halley ();
+
+        taylor (d, sd, cd);
+
+        anomaly[i]  = mean[i] + d;
+        sine[i]     = sm * cd + cm * sd;
+        cosine[i]   = cm * cd - sm * sd;
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,300 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The area of the intersection of two ellipses.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        overlap.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Deduplicating detections requires the overlap of ellipses.  This file defines
+ * the exact area of the intersection of two ellipses within the x-y plane.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+
+
+
+/**
+ * \brief   The area of the intersection of two planar ellipses.
+ * \param   first   The first ellipse.
+ * \param   second  The second ellipse.
+ * \return  The area of the intersection.
+ *
+ * At first, both ellipses are mapped by the affine map which turns the first
+ * one into the unit circle.  The second one becomes the ellipse
+ * `c + P cos (s) + Q sin (s)`.  A point `(cos (t), sin (t))` of the circle lies
+ * on this ellipse in case its coordinates with respect to `P` and `Q` have
+ * unit length.  This is a trigonometric polynomial of degree two in `t` which
+ * is turned into a quartic polynomial by the substitution `u = tan (t / 2)`.
+ * The substitution is rotated such that `u` is infinite at the one of eight
+ * samples at multiples of `pi / 4` with the greatest magnitude, hence, the
+ * leading coefficient does not vanish.  The real roots are found by `quartic`.
+ *
+ * The boundary of the intersection consists of the arcs of the circle within
+ * the ellipse and the arcs of the ellipse within the circle.  By Green's
+ * theorem, its area is half of the integral of `x dy - y dx` along these
+ * arcs.  An arc of the circle from `t0` to `t1` contributes `(t1 - t0) / 2`,
+ * an arc of the ellipse from `s0` to `s1` contributes
+ * `(c x P (cos s1 - cos s0) + c x Q (sin s1 - sin s0) + P x Q (s1 - s0)) / 2`.
+ * The crossings are mapped back by rational expressions in `u`, hence, only
+ * their parameters on both curves require an arctangent.  Whether an arc
+ * belongs to the boundary is decided by its midpoint.  Without any crossings,
+ * either one ellipse contains the other one or both are disjoint.  In case the
+ * polynomial vanishes up to rounding, both ellipses coincide.  Finally, the
+ * area is scaled back by the semi-axes of the first ellipse.
+ *
+ * Since the intersections are refined to the precision of `double`, the area
+ * is exact apart from rounding.  Touching ellipses do not cross, hence, double
+ * roots do not contribute.
+ */
+
+ELLIPSE_INLINE double Ellipse :: overlap  ( const Planar & first
+                                          , const Planar & second
+                                          )
+{
+    const double    pi  {3.141592653589793};
+    const double    a   {first.major};
+    const double    b   {first.minor};
+
+    if (! (a > 0. && b > 0. && second.major > 0. && second.minor > 0.))
+        return 0.;
+
+    const double    dx  {second.cx - first.cx};
+    const double    dy  {second.cy - first.cy};
+
+    if (dx * dx + dy * dy >= (a + second.major) * (a + second.major))
+        return 0.;
+
+    const auto  map = [&first, a, b] (const double x, const double y
+                                     , double & u, double & v
+                                     ) -> void
+    {
+        u = (x * first.cosine + y * first.sine) / a;
+        v = (y * first.cosine - x * first.sine) / b;
+        return;
+    };
+
+    double  c   [0x2]   {};
+    double  p   [0x2]   {};
+    double  q   [0x2]   {};
+
+    map (dx, dy, c[0x0], c[0x1]);
+    map ( second.major * second.cosine
+        , second.major * second.sine
+        , p[0x0]
+        , p[0x1]
+        );
+    map ( - second.minor * second.sine
+        , second.minor * second.cosine
+        , q[0x0]
+        , q[0x1]
+        );
+
+    const double    det {p[0x0] * q[0x1] - p[0x1] * q[0x0]};
+    const double    alpha   [0x3]
+        { (c[0x1] * q[0x0] - c[0x0] * q[0x1]) / det
+        , q[0x1] / det
+        , - q[0x0] / det
+        };
+    const double    beta    [0x3]
+        { (c[0x0] * p[0x1] - c[0x1] * p[0x0]) / det
+        , - p[0x1] / det
+        , p[0x0] / det
+        };
+
+    const double    g   [0x5]
+        { alpha[0x0] * alpha[0x0] + beta[0x0] * beta[0x0] - 1.
+        + 0.5 * ( alpha[0x1] * alpha[0x1] + alpha[0x2] * alpha[0x2]
+                + beta[0x1] * beta[0x1] + beta[0x2] * beta[0x2]
+                )
+        , 2. * (alpha[0x0] * alpha[0x1] + beta[0x0] * beta[0x1])
+        , 2. * (alpha[0x0] * alpha[0x2] + beta[0x0] * beta[0x2])
+        , 0.5 * ( alpha[0x1] * alpha[0x1] - alpha[0x2] * alpha[0x2]
+                + beta[0x1] * beta[0x1] - beta[0x2] * beta[0x2]
+                )
+        , alpha[0x1] * alpha[0x2] + beta[0x1] * beta[0x2]
+        };
+
+    const double    r       {0.7071067811865476};
+    const double    cosines [0x8]   {1., r, 0., - r, -1., - r, 0., r};
+    const double    sines   [0x8]   {0., r, 1., r, 0., - r, -1., - r};
+    size_t          start   {0x0};
+    double          peak    {0.};
+
+    for (size_t i = 0x0; i < 0x8; i++)
+    {
+        const double    f
+            { g[0x0] + g[0x1] * cosines[i] + g[0x2] * sines[i]
+            + g[0x3] * cosines[(0x2 * i) % 0x8]
+            + g[0x4] * sines[(0x2 * i) % 0x8]
+            };
+
+        if (std :: abs (f) > std :: abs (peak))
+        {
+            start   = i;
+            peak    = f;
+        };
+    };
+
+    if (std :: abs (peak) <= 1e-12)
+        return pi * a * b * std :: min (1., det);
+
+    const double    c1  {- cosines[start]};
+    const double    s1  {- sines[start]};
+    const double    c2  {cosines[(0x2 * start) % 0x8]};
+    const double    s2  {sines[(0x2 * start) % 0x8]};
+    const double    h1  {g[0x1] * c1 + g[0x2] * s1};
+    const double    k1  {g[0x2] * c1 - g[0x1] * s1};
+    const double    h2  {g[0x3] * c2 + g[0x4] * s2};
+    const double    k2  {g[0x4] * c2 - g[0x3] * s2};
+    const double    polynomial  [0x5]
+        { g[0x0] + h1 + h2
+        , 2. * k1 + 4. * k2
+        , 2. * g[0x0] - 6. * h2
+        , 2. * k1 - 4. * k2
+        , g[0x0] - h1 + h2
+        };
+
+    const auto  value   = [&polynomial] (const double u) -> double
+    {
+        return (((polynomial[0x4] * u + polynomial[0x3]) * u
+                + polynomial[0x2]) * u + polynomial[0x1]) * u + polynomial[0x0];
+    };
+
+    double          roots   [0x4]   {};
+    const size_t    count   {Ellipse :: quartic (polynomial, roots)};
+
+    if (count < 0x2)
+    {
+        if (peak < 0.)
+            return pi * a * b;
+
+        if (c[0x0] * c[0x0] + c[0x1] * c[0x1] < 1.)
+            return pi * a * b * det;
+
+        return 0.;
+    };
+
+    double  t       [0x4]   {};
+    double  s       [0x4]   {};
+    double  cosine  [0x4]   {};
+    double  sine    [0x4]   {};
+    size_t  index   [0x4]   {0x0, 0x1, 0x2, 0x3};
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const double    u   {roots[i]};
+        const double    w   {1. / (1. + u * u)};
+        const double    cu  {(1. - u * u) * w};
+        const double    su  {2. * u * w};
+        const double    x   {cu * c1 - su * s1 - c[0x0]};
+        const double    y   {su * c1 + cu * s1 - c[0x1]};
+
+        t[i]        = 2. * std :: atan (u);
+        cosine[i]   = (x * q[0x1] - y * q[0x0]) / det;
+        sine[i]     = (p[0x0] * y - p[0x1] * x) / det;
+        s[i]        = std :: atan2 (sine[i], cosine[i]);
+    };
+
+    std :: sort ( index
+                , index + count
+                , [&s] (const size_t i, const size_t j) -> bool
+                {
+                    return s[i] < s[j];
+                }
+                );
+
+    const double    cp  {c[0x0] * p[0x1] - c[0x1] * p[0x0]};
+    const double    cq  {c[0x0] * q[0x1] - c[0x1] * q[0x0]};
+    double          ret {0.};
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const bool      wrap    {i + 0x1 == count};
+        const size_t    j       {index[i]};
+        const size_t    k       {index[wrap ? 0x0 : i + 0x1]};
+        const double    t0      {t[i]};
+        const double    t1      {wrap ? t[0x0] + 2. * pi : t[i + 0x1]};
+        const double    s0      {s[j]};
+        const double    s1      {wrap ? s[k] + 2. * pi : s[k]};
+        double          mc      {cosine[j] + cosine[k]};
+        double          ms      {sine[j] + sine[k]};
+        const double    length  {sqrt (mc * mc + ms * ms)};
+
+        if (length > 1e-9)
+        {
+            mc  /= s1 - s0 < pi ? length : - length;
+            ms  /= s1 - s0 < pi ? length : - length;
+        }
+        else
+        {
+            mc  = - sine[j];
+            ms  = cosine[j];
+        };
+
+        const double    x   {c[0x0] + p[0x0] * mc + q[0x0] * ms};
+        const double    y   {c[0x1] + p[0x1] * mc + q[0x1] * ms};
+        const double    f
+            {wrap ? peak : value (0.5 * (roots[i] + roots[i + 0x1]))};
+
+        if (f < 0.)
+            ret += 0.5 * (t1 - t0);
+
+        if (x * x + y * y < 1.)
+            ret += 0.5 * ( cp * (cosine[k] - cosine[j])
+                         + cq * (sine[k] - sine[j])
+                         + det * (s1 - s0)
+                         );
+    };
+
+    return ret * a * b;
+}
+
+
+
+/**
+ * \brief   The area of the intersection with another ellipse.
+ * \param   other   The other ellipse.
+ * \return  The area of the intersection.
+ *
+ * Both ellipses are regarded within the x-y plane, as placed by their centres
+ * and the directions of their tangents.  This is the same placement as for the
+ * rasterisation and the conics.  The area is exact apart from rounding.
+ */
+
+ELLIPSE_INLINE float Ellipse :: overlap (const Ellipse & other) const
+{
+    ELLIPSE_COUNT ("overlap");
+
+    return float (Ellipse :: overlap (this -> planar (), other.planar ()));
+}
+
+/******************************************************************************/
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Recover the parameter value of a point.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        parameter_of.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Snapping, unwrapping and arc length lookups require the parameter value of a
+ * given point on or near the ellipse, which is the inverse of the evaluation.
+ * This file defines a fast inversion as well as an exact refinement to the
+ * closest curve point, both for single points and for batches.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Determine the parameter value of a point.
+ * \param   x       The x coordinate of the point.
+ * \param   y       The y coordinate of the point.
+ * \param   z       The z coordinate of the point.
+ * \param   refine  Whether to return the parameter of the closest curve point.
+ * \return  The parameter value within `[-pi, pi]`.
+ *
+ * This overload calls the batch overload for a single point.  See there for
+ * the details and the accuracy.
+ */
+
+ELLIPSE_INLINE float Ellipse :: parameter_of  ( const float x
+                                              , const float y
+                                              , const float z
+                                              , const bool refine
+                                              ) const
+{
+    ELLIPSE_COUNT ("parameter_of");
+
+    float   t   {};
+
+    this -> parameter_of (& x, & y, & z, 0x1, & t, refine);
+
+    return t;
+}
+
+
+
+/**
+ * \brief   Determine the parameter values of a batch of points.
+ * \param   x       The x coordinates of the points.
+ * \param   y       The y coordinates of the points.
+ * \param   z       The z coordinates of the points.
+ * \param   count   The count of points.
+ * \param   t       The parameter values within `[-pi, pi]`.
+ * \param   refine  Whether to return the parameters of the closest curve
+ *                  points.
+ *
+ * The points are given in world coordinates, as returned by `eval_world`, and
+ * are projected into the frame spanned by the centre, the tangent and the
+ * normal of this ellipse, as determined by `basis`.  Within this frame, the
+ * curve point of parameter `t` is `(a cos t, b sin t)`, as returned by `eval`.
+ * Hence, a point on the ellipse is mapped to its parameter value by
+ * `atan2 (v / b, u / a)`, i.e. its eccentric anomaly.  For points off the
+ * curve, this is the parameter of the intersection of the ellipse with the ray
+ * from the centre through the point after scaling the ellipse to the unit
+ * circle.  The centre itself is mapped to zero.
+ *
+ * Thus, `parameter_of` inverts `eval_world` for any placement of the ellipse,
+ * whereas the local points of `eval` are only inverted for ellipses centred at
+ * the origin whose major and minor axes are the x and the y axis.
+ *
+ * The arc tangent is evaluated by `Trig :: angle`, whose absolute error is less
+ * than 3e-7.  Hence, the result differs from the exact parameter by less than
+ * 5e-7 for points on the curve, apart from the rounding of their coordinates.
+ * The points are processed in SIMD lanes.
+ *
+ * In case `refine` is set, the parameter of the closest curve point is
+ * determined by `closest`, instead.  This is exact up to the precision of
+ * `float` but considerably slower and not processed in SIMD lanes.
+ */
+
+ELLIPSE_INLINE void Ellipse :: parameter_of   ( const float * x
+                                              , const float * y
+                                              , const float * z
+                                              , const size_t count
+                                              , float * t
+                                              , const bool refine
+                                              ) const
+{
+    ELLIPSE_COUNT ("parameter_of (batch)");
+    ELLIPSE_TIME ("parameter_of (batch)");
+
+    double  frame   [0x2][0x3]  {};
+
+    this -> basis (frame[0x0], frame[0x1]);
+
+    const float cx  {this -> centre[0x0]};
+    const float cy  {this -> centre[0x1]};
+    const float cz  {this -> centre[0x2]};
+    const float ux  {float (frame[0x0][0x0])};
+    const float uy  {float (frame[0x0][0x1])};
+    const float uz  {float (frame[0x0][0x2])};
+    const float vx  {float (frame[0x1][0x0])};
+    const float vy  {float (frame[0x1][0x1])};
+    const float vz  {float (frame[0x1][0x2])};
+    const float a   {this -> major};
+    const float b   {this -> minor};
+
+    if (refine)
+    {
+        for (size_t i = 0x0; i < count; i++)
+        {
+            const float dx  {x[i] - cx};
+            const float dy  {y[i] - cy};
+            const float dz  {z[i] - cz};
+
+            this -> closest ( dx * ux + dy * uy + dz * uz
+                            , dx * vx + dy * vy + dz * vz
+                            , t[i]
+                            );
+        };
+
+        return;
+    };
+
+#pragma omp simd
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const float dx  {x[i] - cx};
+        const float dy  {y[i] - cy};
+        const float dz  {z[i] - cz};
+
+        // The arguments of atan2 (v / b, u / a), multiplied by a b.
+        const float p   {(dx * ux + dy * uy + dz * uz) * b};
+        const float q   {(dx * vx + dy * vy + dz * vz) * a};
+
+        t[i] = Trig :: angle (q, p);
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Rebuild the parametrisation of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        parametrise.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The coordinate functions capture the semi-axes by value such that they can be
+ * evaluated without referring to the ellipse.  Hence, they need to be rebuilt
+ * whenever one of the semi-axes changes.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Rebuild the coordinate functions of this ellipse.
+ *
+ * The functions are built from the current semi-axes.  Since the ellipse lies
+ * within its local x-y plane, the z coordinate function does not depend on the
+ * semi-axes and is built once by `init`.  Each lambda only captures a single
+ * float such that it fits into the small buffer of `std :: function` and no
+ * memory is allocated.
+ */
+
+ELLIPSE_INLINE void Ellipse :: parametrise (void)
+{
+    const float major   {this -> major};
+    const float minor   {this -> minor};
+
+    this -> x   = [major] (const float t) -> float {return major * cos (t);};
+    this -> y   = [minor] (const float t) -> float {return minor * sin (t);};
+
+    return;
+}
+
+/******************************************************************************/
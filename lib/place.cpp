@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Place a tessellated shape like the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        place.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * A tessellated shape is stored within the local frame of the ellipse such that
+ * it can be shared among all ellipses with the same semi-axes.  Placing it by
+ * the centre, the tangent and the normal is a single affine pass over its
+ * vertices.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Place a canonical polyline by the frame of this ellipse.
+ * \param   polyline    The polyline within the local frame.
+ * \param   x           The x coordinates of the vertices.
+ * \param   y           The y coordinates of the vertices.
+ * \param   z           The z coordinates of the vertices.
+ * \return  The count of vertices.
+ *
+ * The output vectors are resized to the count of vertices, which does not
+ * allocate memory once their capacity suffices.  Otherwise, the three vectors
+ * are tracked as one allocation by the instrumentation.  Each vertex is the
+ * centre plus the local coordinates along the unit vectors of the basis,
+ * computed in SIMD lanes.
+ */
+
+ELLIPSE_INLINE
+size_t Ellipse :: place ( const Tessellation :: Polyline & polyline
+                        , vector <float> & x
+                        , vector <float> & y
+                        , vector <float> & z
+                        ) const
+{
+    ELLIPSE_TIME ("place (batch)");
+
+    const size_t    count   {polyline.u.size ()};
+
+    if (x.capacity () < count || y.capacity () < count || z.capacity () < count)
+    {
+        ELLIPSE_ALLOCATE (0x3 * count * sizeof (float));
+    };
+
+    x.resize (count);
+    y.resize (count);
+    z.resize (count);
+
+    double  frame   [0x2][0x3]  {};
+
+    this -> basis (frame[0x0], frame[0x1]);
+
+    const float     cx  {this -> centre[0x0]};
+    const float     cy  {this -> centre[0x1]};
+    const float     cz  {this -> centre[0x2]};
+    const float     ux  {float (frame[0x0][0x0])};
+    const float     uy  {float (frame[0x0][0x1])};
+    const float     uz  {float (frame[0x0][0x2])};
+    const float     vx  {float (frame[0x1][0x0])};
+    const float     vy  {float (frame[0x1][0x1])};
+    const float     vz  {float (frame[0x1][0x2])};
+    const float *   u   {polyline.u.data ()};
+    const float *   v   {polyline.v.data ()};
+    float *         px  {x.data ()};
+    float *         py  {y.data ()};
+    float *         pz  {z.data ()};
+
+#pragma omp simd
+    for (size_t i = 0x0; i < count; i++)
+    {
+        px[i]   = cx + u[i] * ux + v[i] * vx;
+        py[i]   = cy + u[i] * uy + v[i] * vy;
+        pz[i]   = cz + u[i] * uz + v[i] * vz;
+    };
+
+    return count;
+}
+
+/******************************************************************************/
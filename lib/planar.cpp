@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The placement of the considered ellipse within the x-y plane.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        planar.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Overlap computations regard ellipses as shapes within the x-y plane, such as
+ * the outputs of detectors.  This file defines how an ellipse is reduced to
+ * such a shape.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   The placement of this ellipse within the x-y plane.
+ * \return  The centre, the semi-axes and the direction of the major axis.
+ *
+ * The major axis is assumed to point into the direction of the tangent's
+ * projection onto the x-y plane, which is the same placement as for the
+ * rasterisation.  In case this projection vanishes, the major axis is parallel
+ * to the x axis.
+ */
+
+ELLIPSE_INLINE Ellipse :: Planar Ellipse :: planar (void) const
+{
+    const double    tx      {this -> tangent[0x0]};
+    const double    ty      {this -> tangent[0x1]};
+    const double    norm    {sqrt (tx * tx + ty * ty)};
+    Planar          ret     {};
+
+    ret.cx      = this -> centre[0x0];
+    ret.cy      = this -> centre[0x1];
+    ret.major   = this -> major;
+    ret.minor   = this -> minor;
+    ret.cosine  = norm > 0. ? tx / norm : 1.;
+    ret.sine    = norm > 0. ? ty / norm : 0.;
+
+    return ret;
+}
+
+/******************************************************************************/
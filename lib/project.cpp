@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Project the considered ellipse into the image plane of a camera.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        project.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Under a pinhole camera, the image of an ellipse is the intersection of the
+ * image plane with the cone through the camera centre and the ellipse.  Hence,
+ * it is a conic, as well, which can be determined exactly from the plane of the
+ * ellipse and the camera matrix, without sampling any curve points.
+ *
+ * This file defines the projection of a single ellipse as well as of a whole
+ * batch of ellipses given as arrays.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Project this ellipse into the image plane of a camera.
+ * \param   camera  The 3x4 camera matrix in row-major order.
+ * \param   image   The projected ellipse within the image plane.
+ * \return  Whether the image of this ellipse is an ellipse.
+ *
+ * The projected ellipse lies within the x-y plane of the image coordinates.
+ * Its normal is the z axis and its tangent points into the direction of the
+ * major axis.  Hence, it can be rasterised directly.
+ *
+ * In case the image is not a proper ellipse, `image` is not changed.  This is
+ * the case if the camera centre lies within the plane of this ellipse or if
+ * this ellipse is not entirely in front of the camera.
+ */
+
+ELLIPSE_INLINE bool Ellipse :: project (const float * camera, Ellipse & image)
+    const
+{
+    ELLIPSE_COUNT ("project");
+
+    float   input   [0xb]
+        { this -> centre[0x0], this -> centre[0x1], this -> centre[0x2]
+        , this -> tangent[0x0], this -> tangent[0x1], this -> tangent[0x2]
+        , this -> normal[0x0], this -> normal[0x1], this -> normal[0x2]
+        , this -> major, this -> minor
+        };
+    float   output  [0xb]   {};
+
+    const Batch ellipses
+        { {& input[0x0], & input[0x1], & input[0x2]}
+        , {& input[0x3], & input[0x4], & input[0x5]}
+        , {& input[0x6], & input[0x7], & input[0x8]}
+        , & input[0x9]
+        , & input[0xa]
+        };
+    const Batch images
+        { {& output[0x0], & output[0x1], & output[0x2]}
+        , {& output[0x3], & output[0x4], & output[0x5]}
+        , {& output[0x6], & output[0x7], & output[0x8]}
+        , & output[0x9]
+        , & output[0xa]
+        };
+
+    if (! Ellipse :: project (camera, ellipses, 0x1, images))
+        return false;
+
+    image = Ellipse ( output[0xa]
+                    , output[0x9] - output[0xa]
+                    , output[0x0]
+                    , output[0x1]
+                    , 0.f
+                    , output[0x3]
+                    , output[0x4]
+                    , 0.f
+                    , 0.f
+                    , 0.f
+                    , 1.f
+                    );
+
+    return true;
+}
+
+
+
+/**
+ * \brief   Project a batch of ellipses into the image plane of a camera.
+ * \param   camera      The 3x4 camera matrix in row-major order.
+ * \param   ellipses    The ellipses to project.
+ * \param   count       The count of ellipses.
+ * \param   images      The projected ellipses.
+ * \return  The count of ellipses whose image is an ellipse.
+ *
+ * The plane of each ellipse is mapped to the image plane by the homography
+ * `H = P [u v 0; 0 0 1]` whose columns are the images of the major axis, the
+ * minor axis and the centre.  Within the plane, the ellipse is given by the
+ * conic `D = diag (1 / a^2, 1 / b^2, -1)`.  Thus, its image is the conic
+ * `adj (H)^T D adj (H)`, which is exactly the intersection of the image plane
+ * with the cone through the camera centre and the ellipse.  Then, the centre,
+ * the semi-axes and the orientation are obtained from the conic in closed
+ * form by `Conic :: parameters`.  Each ellipse costs a fixed count of
+ * operations, independently of its size.
+ *
+ * The projected ellipses lie within the x-y plane of the image coordinates.
+ * Their normals are the z axis and their tangents point into the direction of
+ * their major axes.  In case an image is not a proper ellipse, all of its
+ * values are set to zero.  This is the case if the camera centre lies within
+ * the plane of the ellipse or if the ellipse is not entirely in front of the
+ * camera, meaning that the third homogeneous coordinate of any of its points
+ * is not positive.
+ *
+ * `images` may refer to the same arrays as `ellipses`.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: project  ( const float * camera
+                                          , const Batch & ellipses
+                                          , const size_t count
+                                          , const Batch & images
+                                          )
+{
+    ELLIPSE_COUNT ("project (batch)");
+    ELLIPSE_TIME ("project (batch)");
+
+    size_t  ret {0x0};
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const float     centre  [0x3]
+            { ellipses.centre[0x0][i]
+            , ellipses.centre[0x1][i]
+            , ellipses.centre[0x2][i]
+            };
+        const float     tangent [0x3]
+            { ellipses.tangent[0x0][i]
+            , ellipses.tangent[0x1][i]
+            , ellipses.tangent[0x2][i]
+            };
+        const float     normal  [0x3]
+            { ellipses.normal[0x0][i]
+            , ellipses.normal[0x1][i]
+            , ellipses.normal[0x2][i]
+            };
+        const double    a       {ellipses.major[i]};
+        const double    b       {ellipses.minor[i]};
+
+        double  u   [0x3]   {};
+        double  v   [0x3]   {};
+        double  h   [0x3][0x3]  {};
+
+        Ellipse :: basis (tangent, normal, u, v);
+
+        for (size_t r = 0x0; r < 0x3; r++)
+        {
+            h[r][0x2] = camera[r * 0x4 + 0x3];
+
+            for (size_t c = 0x0; c < 0x3; c++)
+            {
+                h[r][0x0]   += camera[r * 0x4 + c] * u[c];
+                h[r][0x1]   += camera[r * 0x4 + c] * v[c];
+                h[r][0x2]   += camera[r * 0x4 + c] * centre[c];
+            };
+        };
+
+        const double    depth
+            { h[0x2][0x2]
+            - sqrt (a * a * h[0x2][0x0] * h[0x2][0x0]
+                   + b * b * h[0x2][0x1] * h[0x2][0x1]
+                   )
+            };
+
+        bool    valid   {a > 0. && b > 0. && depth > 0.};
+        double  adj     [0x3][0x3]  {};
+        Conic   image   {};
+
+        for (size_t r = 0x0; r < 0x3 && valid; r++)
+            for (size_t c = 0x0; c < 0x3; c++)
+                adj[r][c]
+                    = h[(c + 0x1) % 0x3][(r + 0x1) % 0x3]
+                    * h[(c + 0x2) % 0x3][(r + 0x2) % 0x3]
+                    - h[(c + 0x1) % 0x3][(r + 0x2) % 0x3]
+                    * h[(c + 0x2) % 0x3][(r + 0x1) % 0x3];
+
+        const double    d   [0x3]   {1. / (a * a), 1. / (b * b), -1.};
+
+        for (size_t r = 0x0; r < 0x3 && valid; r++)
+            for (size_t c = 0x0; c < 0x3; c++)
+                for (size_t k = 0x0; k < 0x3; k++)
+                    image.matrix[r][c] += adj[k][r] * d[k] * adj[k][c];
+
+        double  parameters  [0x5]   {};
+
+        valid = valid && image.parameters ( parameters[0x0]
+                                          , parameters[0x1]
+                                          , parameters[0x2]
+                                          , parameters[0x3]
+                                          , parameters[0x4]
+                                          );
+
+        Ellipse :: store (images, i, valid, parameters);
+        ret += valid;
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
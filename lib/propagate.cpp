@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Propagate bodies along their orbits.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        propagate.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Simulations of constellations advance many bodies on a few fixed orbits per
+ * time step.  This file defines the propagator which advances the mean
+ * anomalies of all bodies, solves Kepler's equation for them and determines
+ * their positions in space, distributed among several threads.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+
+
+/**
+ * \brief   Advance a batch of bodies along their orbits by one time step.
+ * \param   orbits      The orbits the bodies move on.
+ * \param   orbit_count The count of orbits.
+ * \param   bodies      The bodies to advance.
+ * \param   count       The count of bodies.
+ * \param   gravitation The standard gravitational parameter of the attractor.
+ * \param   step        The time step.
+ * \param   threads     The count of threads to use, or zero for all cores.
+ *
+ * Each body refers to its orbit by an index into `orbits`.  The attractor is
+ * situated in the focus on the positive side of the major axis of each orbit.
+ * Hence, the numerical eccentricity of an orbit is `sqrt (1 - b^2 / a^2)` and
+ * its mean motion is `sqrt (gravitation / a^3)`.  The semi-major axis needs to
+ * be at least as long as the semi-minor one.
+ *
+ * The mean anomaly of each body is advanced by the mean motion times `step`
+ * and reduced to `[-pi, pi]`.  Then, Kepler's equation is solved for the
+ * eccentric anomaly which is the parameter of the body's position on the
+ * orbit.  The positions are written in world coordinates, using the centre,
+ * the tangent and the normal of the orbit as `project` does.
+ *
+ * At first, the orbital elements are derived once per call.  Then, the bodies
+ * are divided into chunks of 16384 bodies which are distributed dynamically
+ * among the threads.  Within each chunk, blocks of 256 bodies are processed in
+ * SIMD lanes.  The result does not depend on the count of threads.
+ */
+
+ELLIPSE_INLINE void Ellipse :: propagate  ( const Ellipse * orbits
+                                          , const size_t orbit_count
+                                          , const Bodies & bodies
+                                          , const size_t count
+                                          , const float gravitation
+                                          , const float step
+                                          , const size_t threads
+                                          )
+{
+    ELLIPSE_COUNT ("propagate (batch)");
+    ELLIPSE_TIME ("propagate (batch)");
+    ELLIPSE_ALLOCATE (0xb * orbit_count * sizeof (float));
+
+    // The orbital elements, stored as arrays:  centre, major axis, minor axis,
+    // eccentricity and the advance of the mean anomaly per step.
+    vector <float>  elements    (0xb * orbit_count);
+
+    float * const   centre  [0x3]
+        { & elements[0x0 * orbit_count]
+        , & elements[0x1 * orbit_count]
+        , & elements[0x2 * orbit_count]
+        };
+    float * const   major   [0x3]
+        { & elements[0x3 * orbit_count]
+        , & elements[0x4 * orbit_count]
+        , & elements[0x5 * orbit_count]
+        };
+    float * const   minor   [0x3]
+        { & elements[0x6 * orbit_count]
+        , & elements[0x7 * orbit_count]
+        , & elements[0x8 * orbit_count]
+        };
+    float * const   eccentricity    {& elements[0x9 * orbit_count]};
+    float * const   advance         {& elements[0xa * orbit_count]};
+
+    for (size_t j = 0x0; j < orbit_count; j++)
+    {
+        const Ellipse & orbit   {orbits[j]};
+        const double    a       {orbit.major};
+        const double    b       {orbit.minor};
+
+        double  u   [0x3]   {};
+        double  v   [0x3]   {};
+
+        Ellipse :: basis (orbit.tangent.data (), orbit.normal.data (), u, v);
+
+        for (size_t k = 0x0; k < 0x3; k++)
+        {
+            centre[k][j]    = orbit.centre[k];
+            major[k][j]     = float (a * u[k]);
+            minor[k][j]     = float (b * v[k]);
+        };
+
+        const double    ratio   {a > 0. ? std :: min (b / a, 1.) : 1.};
+
+        eccentricity[j] = float (sqrt (1. - ratio * ratio));
+        advance[j]      = a > 0. ? float (step * sqrt (gravitation / a / a / a))
+                                 : 0.f;
+    };
+
+    const size_t            size    {0x4000};
+    const size_t            chunks  {(count + size - 0x1) / size};
+    std :: atomic <size_t>  next    {0x0};
+
+    const auto  work    = [&] (void) -> void
+    {
+        const size_t    block   {0x100};
+
+        float   e       [block];
+        float   anomaly [block];
+        float   sine    [block];
+        float   cosine  [block];
+
+        for (size_t chunk = next++; chunk < chunks; chunk = next++)
+        {
+            const size_t    end {std :: min ((chunk + 0x1) * size, count)};
+
+            for (size_t begin = chunk * size; begin < end; begin += block)
+            {
+                const size_t        length  {std :: min (block, end - begin)};
+                const uint32_t *    orbit   {bodies.orbit + begin};
+                float *             mean    {bodies.mean + begin};
+
+#pragma omp simd
+                for (size_t i = 0x0; i < length; i++)
+                {
+                    const float m       {mean[i] + advance[orbit[i]]};
+                    const float turns   {m * 0.15915494f};
+                    const float whole
+                        {float (int (turns + (turns < 0.f ? -0.5f : 0.5f)))};
+
+                    mean[i] = m - whole * 6.28318531f;
+                    e[i]    = eccentricity[orbit[i]];
+                };
+
+                Ellipse :: kepler (mean, e, length, anomaly, sine, cosine);
+
+                for (size_t k = 0x0; k < 0x3; k++)
+                {
+                    float * const       p   {bodies.position[k] + begin};
+                    const float * const c   {centre[k]};
+                    const float * const a   {major[k]};
+                    const float * const b   {minor[k]};
+
+#pragma omp simd
+                    for (size_t i = 0x0; i < length; i++)
+                        p[i]    = c[orbit[i]]
+                                + a[orbit[i]] * cosine[i]
+                                + b[orbit[i]] * sine[i];
+                };
+            };
+        };
+
+        return;
+    };
+
+    const size_t            cores   {std :: thread :: hardware_concurrency ()};
+    const size_t            wanted  {threads ? threads : cores ? cores : 0x1};
+    const size_t            workers {std :: min (wanted, chunks)};
+    vector <std :: thread>  pool    {};
+
+    for (size_t i = 0x1; i < workers; i++)
+        pool.emplace_back (work);
+
+    work ();
+
+    for (std :: thread & thread : pool)
+        thread.join ();
+
+    return;
+}
+
+/******************************************************************************/
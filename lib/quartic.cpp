@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Real roots of quartic polynomials.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        quartic.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The intersections of two ellipses are the roots of a quartic polynomial.
+ * This file defines how the real ones are found reliably, also for almost
+ * tangent ellipses.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+
+
+
+/**
+ * \brief   Find the real roots of a quartic polynomial.
+ * \param   p       The coefficients, starting with the constant one.
+ * \param   roots   The roots in ascending order.
+ * \return  The count of roots.
+ *
+ * Only the roots at which the polynomial changes its sign are reported, hence,
+ * double roots are omitted.  The leading coefficient must not vanish.
+ *
+ * The roots are isolated by the ones of the derivatives.  The second derivative
+ * is quadratic and its roots are determined in closed form.  They split the
+ * real line into up to three intervals on which the first derivative is
+ * monotonic.  Hence, each of them contains at most one root of the first
+ * derivative, which in turn split the real line into intervals containing at
+ * most one root of the polynomial.  All roots are bounded by the Cauchy
+ * bound.  Within each interval, the root is refined by Newton steps
+ * which start at the middle of the bracket and fall back to bisection in case
+ * they leave the current bracket.  Since the convergence is quadratic, the
+ * refinement stops after the first step below 1e-10, which usually takes less
+ * than ten steps.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: quartic  ( const double (& p) [0x5]
+                                          , double (& roots) [0x4]
+                                          )
+{
+    double  bound   {0.};
+
+    for (size_t i = 0x0; i < 0x4; i++)
+        bound = std :: max (bound, std :: abs (p[i] / p[0x4]));
+
+    bound += 1.;
+
+    double  q   [0x5][0x5]  {};
+
+    for (size_t i = 0x0; i < 0x5; i++)
+        q[0x4][i] = p[i];
+
+    for (size_t k = 0x4; k > 0x1; k--)
+        for (size_t i = 0x1; i <= k; i++)
+            q[k - 0x1][i - 0x1] = double (i) * q[k][i];
+
+    const auto  horner  = [&q] (const size_t k, const double x) -> double
+    {
+        double  ret {q[k][k]};
+
+        for (size_t i = k; i; i--)
+            ret = ret * x + q[k][i - 0x1];
+
+        return ret;
+    };
+
+    const double    a   {q[0x2][0x2]};
+    const double    b   {q[0x2][0x1]};
+    const double    c   {q[0x2][0x0]};
+    const double    d   {b * b - 4. * a * c};
+    double          found   [0x4]   {};
+    size_t          ret             {0x0};
+
+    if (d > 0.)
+    {
+        const double    h   {-0.5 * (b < 0. ? b - sqrt (d) : b + sqrt (d))};
+
+        found[0x0]  = std :: min (h / a, c / h);
+        found[0x1]  = std :: max (h / a, c / h);
+        ret         = 0x2;
+    };
+
+    for (size_t k = 0x3; k <= 0x4; k++)
+    {
+        double  breaks  [0x5]   {- bound};
+        size_t  count           {0x1};
+
+        for (size_t i = 0x0; i < ret; i++)
+            if (std :: abs (found[i]) < bound)
+                breaks[count++] = found[i];
+
+        breaks[count++] = bound;
+        ret = 0x0;
+
+        for (size_t i = 0x0; i + 0x1 < count; i++)
+        {
+            double          low     {breaks[i]};
+            double          high    {breaks[i + 0x1]};
+            const double    fl      {horner (k, low)};
+            const double    fh      {horner (k, high)};
+
+            if ((fl < 0.) == (fh < 0.) || fl == 0.)
+                continue;
+
+            const bool  rising  {fl < 0.};
+            double      x       {0.5 * (low + high)};
+
+            for (size_t iteration = 0x0; iteration < 0x40; iteration++)
+            {
+                const double    f   {horner (k, x)};
+
+                if (f == 0.)
+                    break;
+
+                if ((f < 0.) == rising)
+                    low = x;
+                else
+                    high = x;
+
+                const double    slope   {horner (k - 0x1, x)};
+                const double    step
+                    {slope != 0. ? f / slope : high - low};
+
+                x -= step;
+
+                if (std :: abs (step) <= 1e-10 * (1. + std :: abs (x)))
+                    break;
+
+                if (! (x > low && x < high))
+                    x = 0.5 * (low + high);
+            };
+
+            found[ret++] = x;
+        };
+    };
+
+    for (size_t i = 0x0; i < ret; i++)
+        roots[i] = found[i];
+
+    return ret;
+}
+
+/******************************************************************************/
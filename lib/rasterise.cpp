@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Rasterise the considered ellipse into a pixel buffer.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        rasterise.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Masks of ellipses are required by image processing and rendering
+ * applications.  Approximating the ellipse by a polygon is both slow and prone
+ * to cracks between adjacent shapes.  Hence, the pixels are determined directly
+ * by a scanline algorithm on the implicit form of the ellipse, including
+ * rotated ones.
+ *
+ * This file defines the rasterisation of a single ellipse as well as a tiled
+ * and multithreaded one for large batches of ellipses.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+
+
+/**
+ * \brief   Rasterise this ellipse into an image.
+ * \param   image   The pixel buffer to write to.
+ * \param   mode    Whether to fill the ellipse or to draw its outline.
+ * \param   value   The value to write into the covered pixels.
+ *
+ * The ellipse is placed into the image by its centre's x and y coordinates,
+ * measured in pixels.  The major axis points into the direction of the
+ * tangent's projection onto the image plane.
+ *
+ * A pixel is covered by the filled ellipse if and only if its centre lies
+ * inside of or on the ellipse.  The outline consists of those covered pixels
+ * which have at least one uncovered neighbour in horizontal or vertical
+ * direction.  Thus, the outline is exactly the boundary of the filled ellipse
+ * and both modes never disagree.
+ *
+ * For 8-bit images, only the least significant byte of `value` is written.
+ * 32-bit images need to be aligned at 4 bytes, including their stride.
+ *
+ * The modes `coverage` and `distance` ignore `value`.  They are described by
+ * `shade`.
+ */
+
+ELLIPSE_INLINE void Ellipse :: rasterise  ( const Image & image
+                                          , const Rasterisation mode
+                                          , const uint32_t value
+                                          ) const
+{
+    ELLIPSE_COUNT ("rasterise");
+
+    this -> rasterise (image, mode, value, 0x0, image.height);
+    return;
+}
+
+
+
+/**
+ * \brief   Rasterise a batch of ellipses into an image.
+ * \param   ellipses    The ellipses to rasterise.
+ * \param   count       The count of ellipses.
+ * \param   image       The pixel buffer to write to.
+ * \param   mode        Whether to fill the ellipses or to draw their outlines.
+ * \param   values      The values to write per ellipse, or `nullptr`.
+ * \param   threads     The count of threads to use, or zero for all cores.
+ *
+ * The image is divided into tiles of 64 rows.  At first, each ellipse is
+ * sorted into the tiles its bounding box overlaps.  Then, the tiles are
+ * distributed dynamically among the threads.  Since each tile is processed by
+ * exactly one thread, no synchronisation is required while writing pixels.
+ *
+ * Within a tile, the ellipses are rasterised in the order they are passed.
+ * Hence, later ellipses overwrite earlier ones and the result does not depend
+ * on the count of threads.
+ *
+ * In case `values` is `nullptr`, all bits of the covered pixels are set.
+ *
+ * For the modes `coverage` and `distance`, the bounding boxes are enlarged by
+ * one pixel since partially covered pixels at the border contribute, as well.
+ * The ellipses are then combined by the maximum coverage and the minimum
+ * distance, respectively, such that their order does not matter.
+ */
+
+ELLIPSE_INLINE void Ellipse :: rasterise  ( const Ellipse * ellipses
+                                          , const size_t count
+                                          , const Image & image
+                                          , const Rasterisation mode
+                                          , const uint32_t * values
+                                          , const size_t threads
+                                          )
+{
+    ELLIPSE_COUNT ("rasterise (batch)");
+    ELLIPSE_TIME ("rasterise (batch)");
+
+    const size_t                rows    {0x40};
+    const size_t                tiles   {(image.height + rows - 0x1) / rows};
+    vector <vector <size_t>>    bins    (tiles);
+    const double                margin
+        {mode == Ellipse :: coverage || mode == Ellipse :: distance ? 1. : 0.};
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        float   width   {0.f};
+        float   height  {0.f};
+
+        ellipses[i].extent (width, height);
+
+        const double    cx      {ellipses[i].centre[0x0]};
+        const double    cy      {ellipses[i].centre[0x1]};
+        const double    left    {cx - width - margin - 0.5};
+        const double    right   {cx + width + margin - 0.5};
+        const double    top     {cy - height - margin - 0.5};
+        const double    bottom  {cy + height + margin - 0.5};
+
+        if  (  ! (right >= 0. && left < double (image.width))
+            || ! (bottom >= 0. && top < double (image.height))
+            )
+            continue;
+
+        const size_t    first   {top > 0. ? size_t (top) / rows : 0x0};
+        const size_t    last
+            {std :: min (size_t (bottom) / rows, tiles - 0x1)};
+
+        for (size_t j = first; j <= last; j++)
+            bins[j].push_back (i);
+    };
+
+    ELLIPSE_ALLOCATE (tiles * sizeof (vector <size_t>));
+
+    for (size_t j = 0x0; j < tiles; j++)
+        ELLIPSE_ALLOCATE (bins[j].capacity () * sizeof (size_t));
+
+    std :: atomic <size_t>  next    {0x0};
+
+    const auto  work    = [&] (void) -> void
+    {
+        for (size_t tile = next++; tile < tiles; tile = next++)
+            for (const size_t i : bins[tile])
+                ellipses[i].rasterise
+                    ( image
+                    , mode
+                    , values ? values[i] : ~ uint32_t (0x0)
+                    , tile * rows
+                    , std :: min ((tile + 0x1) * rows, image.height)
+                    );
+
+        return;
+    };
+
+    const size_t            cores   {std :: thread :: hardware_concurrency ()};
+    const size_t            wanted  {threads ? threads : cores ? cores : 0x1};
+    const size_t            workers {std :: min (wanted, tiles)};
+    vector <std :: thread>  pool    {};
+
+    for (size_t i = 0x1; i < workers; i++)
+        pool.emplace_back (work);
+
+    work ();
+
+    for (std :: thread & thread : pool)
+        thread.join ();
+
+    return;
+}
+
+
+
+/**
+ * \brief   Rasterise the rows of this ellipse within a certain band.
+ * \param   image   The pixel buffer to write to.
+ * \param   mode    Whether to fill the ellipse or to draw its outline.
+ * \param   value   The value to write into the covered pixels.
+ * \param   first   The first row of the band.
+ * \param   last    The row after the last one of the band.
+ *
+ * The ellipse is described by the implicit quadratic form
+ * `p dx^2 + q dx dy + r dy^2 = 1` relative to its centre.  For each row, the
+ * form is solved for `dx` at the height of the pixel centres, yielding the
+ * exact span of covered pixels.  Rotated ellipses are therefore rasterised
+ * without any approximation.
+ *
+ * In outline mode, the spans of the neighbouring rows are determined, as well.
+ * Only the pixels of the span which are not covered by both neighbouring spans,
+ * including the ends of the span, are written.
+ *
+ * The modes `coverage` and `distance` are forwarded to `shade`.
+ */
+
+ELLIPSE_INLINE void Ellipse :: rasterise  ( const Image & image
+                                          , const Rasterisation mode
+                                          , const uint32_t value
+                                          , const size_t first
+                                          , const size_t last
+                                          ) const
+{
+    const double    a   {this -> major};
+    const double    b   {this -> minor};
+
+    if (! (a > 0. && b > 0.) || ! image.pixels)
+        return;
+
+    if (mode == Ellipse :: coverage || mode == Ellipse :: distance)
+    {
+        this -> shade (image, mode, first, last);
+        return;
+    };
+
+    const double    tx      {this -> tangent[0x0]};
+    const double    ty      {this -> tangent[0x1]};
+    const double    norm    {sqrt (tx * tx + ty * ty)};
+    const double    c       {norm > 0. ? tx / norm : 1.};
+    const double    s       {norm > 0. ? ty / norm : 0.};
+    const double    cx      {this -> centre[0x0]};
+    const double    cy      {this -> centre[0x1]};
+    const double    p       {c * c / (a * a) + s * s / (b * b)};
+    const double    q       {2. * c * s * (1. / (a * a) - 1. / (b * b))};
+    const double    r       {s * s / (a * a) + c * c / (b * b)};
+    const double    height  {sqrt (a * a * s * s + b * b * c * c)};
+
+    unsigned char * const   pixels
+        {static_cast <unsigned char *> (image.pixels)};
+
+    const auto  span    = [=] (const double row, double & left, double & right)
+        -> bool
+    {
+        const double    dy  {row + 0.5 - cy};
+        const double    discriminant
+            {q * q * dy * dy - 4. * p * (r * dy * dy - 1.)};
+
+        if (! (discriminant >= 0.))
+            return false;
+
+        const double    root    {sqrt (discriminant)};
+
+        left    = std :: ceil (cx + (- q * dy - root) / (2. * p) - 0.5);
+        right   = std :: floor (cx + (- q * dy + root) / (2. * p) - 0.5);
+
+        return left <= right;
+    };
+
+    const auto  put     = [&] (const double row, double from, double to) -> void
+    {
+        from    = std :: max (from, 0.);
+        to      = std :: min (to, double (image.width) - 1.);
+
+        if (from > to)
+            return;
+
+        unsigned char * const   line    {pixels + size_t (row) * image.stride};
+
+        uint32_t * const        words
+            {reinterpret_cast <uint32_t *> (line)};
+
+        if (image.depth == 0x20)
+            std :: fill ( words + size_t (from)
+                        , words + size_t (to) + 0x1
+                        , value
+                        );
+        else
+            std :: fill ( line + size_t (from)
+                        , line + size_t (to) + 0x1
+                        , static_cast <unsigned char> (value)
+                        );
+
+        return;
+    };
+
+    const double    top
+        {std :: max (std :: ceil (cy - height - 0.5), double (first))};
+    const double    bottom
+        {std :: min (std :: floor (cy + height - 0.5), double (last) - 1.)};
+
+    for (double row = top; row <= bottom; row++)
+    {
+        double  left    {0.};
+        double  right   {0.};
+
+        if (! span (row, left, right))
+            continue;
+
+        double  above_left      {0.};
+        double  above_right     {0.};
+        double  below_left      {0.};
+        double  below_right     {0.};
+        double  inner_left      {right + 1.};
+        double  inner_right     {right};
+
+        if  (  mode == Ellipse :: outline
+            && span (row - 1., above_left, above_right)
+            && span (row + 1., below_left, below_right)
+            )
+        {
+            inner_left  = std :: max (std :: max (left + 1., above_left)
+                                     , below_left
+                                     );
+            inner_right = std :: min (std :: min (right - 1., above_right)
+                                     , below_right
+                                     );
+        };
+
+        put (row, left, std :: min (right, inner_left - 1.));
+        put (row, std :: max (left, inner_right + 1.), right);
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Recompute the derived data of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        refresh.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The basis of the plane, the conic, the extent and the perimeter are derived
+ * from the geometry of the ellipse.  This method recomputes all of them at once
+ * such that the queries can read them afterwards.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Recompute the derived data of this ellipse.
+ *
+ * Afterwards, the queries return the stored data until the geometry is changed
+ * by one of the setters.  While recomputing, the stored data is marked as
+ * invalid and the caching mode is switched off temporarily such that the
+ * queries compute their results from the geometry.
+ *
+ * This is the only way to fill the cache in `none` mode.  Furthermore, it is
+ * required before an ellipse is queried by multiple threads in `deferred`
+ * mode.
+ */
+
+ELLIPSE_INLINE void Ellipse :: refresh (void) const
+{
+    ELLIPSE_COUNT ("refresh");
+
+    const Caching   caching {this -> caching};
+
+    this -> caching = Ellipse :: none;
+    this -> cached  = false;
+
+    Ellipse :: basis    ( this -> tangent.data ()
+                        , this -> normal.data ()
+                        , this -> derived.u
+                        , this -> derived.v
+                        );
+
+    this -> derived.conic       = this -> get_conic ();
+    this -> derived.perimeter   = this -> get_perimeter ();
+    this -> extent (this -> derived.width, this -> derived.height);
+
+    this -> caching = caching;
+    this -> cached  = true;
+
+    return;
+}
+
+/******************************************************************************/
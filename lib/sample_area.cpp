@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Sample points uniformly inside the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        sample_area.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Monte Carlo methods, such as coverage estimations or the seeding of
+ * particles, require uniformly distributed points inside an ellipse.  Since the
+ * ellipse is the affine image of the unit disk, uniform points on the disk are
+ * mapped to uniform points inside the ellipse.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+
+
+/**
+ * \brief   Sample points uniformly inside this ellipse.
+ * \param   seed    The seed of the random numbers.
+ * \param   count   The count of points.
+ * \param   x       The x coordinates of the points.
+ * \param   y       The y coordinates of the points.
+ * \param   z       The z coordinates of the points.
+ * \param   threads The count of threads to use, or zero for all cores.
+ *
+ * Point `i` is derived from the output of `Philox :: generate` for the
+ * counter `i` and the key `seed`.  The first number yields the distance
+ * `sqrt (u)` from the centre of the unit disk, the second one the angle.
+ * Then, the point on the unit disk is scaled by the semi-axes and placed in
+ * space by the centre, the tangent and the normal of this ellipse.
+ *
+ * Since each point only depends on its index, the same seed yields the same
+ * points, independently of the count of threads.  The points are processed in
+ * chunks of 16384 points which are distributed dynamically among the threads.
+ * Within each chunk, blocks of 256 points are processed in SIMD lanes, apart
+ * from the sines and cosines.
+ */
+
+ELLIPSE_INLINE void Ellipse :: sample_area    ( const uint64_t seed
+                                              , const size_t count
+                                              , float * x
+                                              , float * y
+                                              , float * z
+                                              , const size_t threads
+                                              ) const
+{
+    ELLIPSE_COUNT ("sample_area (batch)");
+    ELLIPSE_TIME ("sample_area (batch)");
+
+    double  frame   [0x2][0x3]  {};
+
+    this -> basis (frame[0x0], frame[0x1]);
+
+    const float cx  {this -> centre[0x0]};
+    const float cy  {this -> centre[0x1]};
+    const float cz  {this -> centre[0x2]};
+    const float ux  {float (frame[0x0][0x0] * this -> major)};
+    const float uy  {float (frame[0x0][0x1] * this -> major)};
+    const float uz  {float (frame[0x0][0x2] * this -> major)};
+    const float vx  {float (frame[0x1][0x0] * this -> minor)};
+    const float vy  {float (frame[0x1][0x1] * this -> minor)};
+    const float vz  {float (frame[0x1][0x2] * this -> minor)};
+
+    const size_t            size    {0x4000};
+    const size_t            chunks  {(count + size - 0x1) / size};
+    std :: atomic <size_t>  next    {0x0};
+
+    const auto  work    = [&] (void) -> void
+    {
+        const size_t    block   {0x100};
+
+        float   radius  [block];
+        float   angle   [block];
+        float   cosine  [block];
+        float   sine    [block];
+
+        for (size_t chunk = next++; chunk < chunks; chunk = next++)
+        {
+            const size_t    end {std :: min ((chunk + 0x1) * size, count)};
+
+            for (size_t begin = chunk * size; begin < end; begin += block)
+            {
+                const size_t    length  {std :: min (block, end - begin)};
+
+#pragma omp simd
+                for (size_t i = 0x0; i < length; i++)
+                {
+                    uint32_t    random  [0x4];
+
+                    Philox :: generate (begin + i, seed, random);
+
+                    radius[i]   = sqrt (Philox :: uniform (random[0x0]));
+                    angle[i]    = 6.28318531f * Philox :: uniform (random[0x1]);
+                };
+
+                for (size_t i = 0x0; i < length; i++)
+                {
+                    cosine[i]   = cos (angle[i]);
+                    sine[i]     = sin (angle[i]);
+                };
+
+#pragma omp simd
+                for (size_t i = 0x0; i < length; i++)
+                {
+                    const float u   {radius[i] * cosine[i]};
+                    const float v   {radius[i] * sine[i]};
+
+                    x[begin + i]    = cx + u * ux + v * vx;
+                    y[begin + i]    = cy + u * uy + v * vy;
+                    z[begin + i]    = cz + u * uz + v * vz;
+                };
+            };
+        };
+
+        return;
+    };
+
+    const size_t            cores   {std :: thread :: hardware_concurrency ()};
+    const size_t            wanted  {threads ? threads : cores ? cores : 0x1};
+    const size_t            workers {std :: min (wanted, chunks)};
+    vector <std :: thread>  pool    {};
+
+    for (size_t i = 0x1; i < workers; i++)
+        pool.emplace_back (work);
+
+    work ();
+
+    for (std :: thread & thread : pool)
+        thread.join ();
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Lazy streams of equidistant curve points.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        samples.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Consumers which feed curve points into a pipeline would otherwise call `eval`
+ * per point and collect the returned vectors.  Instead, this method creates a
+ * `Stream` which evaluates the points on demand in blocks.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Stream equidistant curve points of this ellipse.
+ * \param   start   The parameter value of the first point.
+ * \param   step    The difference of the parameter values of two points.
+ * \param   count   The count of points, or `SIZE_MAX` for an unbounded stream.
+ * \return  The lazy range of points.
+ *
+ * This overload computes the sines and cosines by the C standard library.
+ */
+
+ELLIPSE_INLINE Stream Ellipse :: samples    ( const float start
+                                            , const float step
+                                            , const size_t count
+                                            ) const
+{
+    return this -> samples (start, step, count, Trig ());
+}
+
+
+
+/**
+ * \brief   Stream equidistant curve points of this ellipse.
+ * \param   start   The parameter value of the first point.
+ * \param   step    The difference of the parameter values of two points.
+ * \param   count   The count of points, or `SIZE_MAX` for an unbounded stream.
+ * \param   trig    The backend computing the sines and the cosines.
+ * \return  The lazy range of points.
+ *
+ * The `i`-th point equals the result of `eval` for the parameter value
+ * `start + i * step` with the given backend.  The points are evaluated in
+ * blocks of 64 points by the batch overload of `eval` while the stream is
+ * iterated.  Hence, neither this method nor the stream allocate memory and the
+ * memory of the stream does not depend on `count`.  This ellipse needs to
+ * outlive the stream.
+ *
+ * The stream can be iterated by a range-based `for` loop and, since C++20,
+ * composed with the range adaptors of the standard library, for instance
+ * `std :: views :: take`.
+ */
+
+ELLIPSE_INLINE Stream Ellipse :: samples    ( const float start
+                                            , const float step
+                                            , const size_t count
+                                            , const Trig & trig
+                                            ) const
+{
+    ELLIPSE_COUNT ("samples");
+
+    return Stream (*this, start, step, count, trig);
+}
+
+/******************************************************************************/
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The setter for the caching mode of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        set_caching.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The caching mode determines whether the data derived from the geometry is
+ * recomputed by the setters, by the next query or not stored at all.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   The setter method for the caching mode.
+ * \param   caching The new caching mode.
+ *
+ * In case the derived data is outdated when switching to `immediate` mode, it
+ * is recomputed at once.  A `deferred` ellipse can thus be modified by a burst
+ * of setter calls before switching back to `immediate` mode, causing only a
+ * single recomputation.
+ */
+
+ELLIPSE_INLINE void Ellipse :: set_caching (const Caching caching)
+{
+    ELLIPSE_COUNT ("set_caching");
+
+    this -> caching = caching;
+
+    if (caching == Ellipse :: immediate && ! this -> cached)
+        this -> refresh ();
+
+    return;
+}
+
+/******************************************************************************/
@@ -46,7 +46,7 @@
  * Set this ellipse's centre to `0.f, 0.f, 0.f`.
  */
 
-inline void Ellipse :: set_centre (void)
+ELLIPSE_INLINE void Ellipse :: set_centre (void)
 {
     this -> set_centre (0.f, 0.f, 0.f);
     return;
@@ -62,7 +62,7 @@ inline void Ellipse :: set_centre (void)
  * this method.
  */
 
-inline void Ellipse :: set_centre (const vector <float> & centre)
+ELLIPSE_INLINE void Ellipse :: set_centre (const vector <float> & centre)
 {
     switch (centre.size ())
     {
@@ -96,13 +96,20 @@ inline void Ellipse :: set_centre (const vector <float> & centre)
  *
  * Since `centre` is a private attribute, it should be set exclusively using
  * this method.
+ *
+ * The derived data is updated according to the caching mode.
  */
 
-inline void Ellipse :: set_centre (const float x, const float y, const float z)
+ELLIPSE_INLINE
+void Ellipse :: set_centre (const float x, const float y, const float z)
 {
+    ELLIPSE_COUNT ("set_centre");
+
     this -> centre[0x0] = x;
     this -> centre[0x1] = y;
     this -> centre[0x2] = z;
+
+    this -> update ();
     return;
 }
 
@@ -46,7 +46,7 @@
  * Set this ellipse's eccentricity to `0.f`.
  */
 
-inline void Ellipse :: set_eccentricity (void)
+ELLIPSE_INLINE void Ellipse :: set_eccentricity (void)
 {
     this -> set_eccentricity (0.f);
     return;
@@ -60,11 +60,21 @@ inline void Ellipse :: set_eccentricity (void)
  *
  * Since `eccentricity` is a private attribute, it should be set exclusively
  * using this method.
+ *
+ * The eccentricity is the difference of the semi-axes.  The minor semi-axis is
+ * kept and the major one is moved accordingly.  The coordinate functions are
+ * rebuilt and the derived data is updated according to the caching mode.
  */
 
-inline void Ellipse :: set_eccentricity (const float eccentricity)
+ELLIPSE_INLINE void Ellipse :: set_eccentricity (const float eccentricity)
 {
-    this -> eccentricity = eccentricity;
+    ELLIPSE_COUNT ("set_eccentricity");
+
+    this -> eccentricity    = eccentricity;
+    this -> major           = this -> minor + eccentricity;
+
+    this -> parametrise ();
+    this -> update ();
     return;
 }
 
@@ -46,7 +46,7 @@
  * Set this ellipse's major to `0.f`.
  */
 
-inline void Ellipse :: set_major (void)
+ELLIPSE_INLINE void Ellipse :: set_major (void)
 {
     this -> set_major (0.f);
     return;
@@ -60,11 +60,21 @@ inline void Ellipse :: set_major (void)
  *
  * Since `major` is a private attribute, it should be set exclusively using this
  * method.
+ *
+ * The minor semi-axis is kept such that the eccentricity, being the difference
+ * of both semi-axes, changes accordingly.  The coordinate functions are
+ * rebuilt and the derived data is updated according to the caching mode.
  */
 
-inline void Ellipse :: set_major (const float major)
+ELLIPSE_INLINE void Ellipse :: set_major (const float major)
 {
-    this -> major = major;
+    ELLIPSE_COUNT ("set_major");
+
+    this -> major           = major;
+    this -> eccentricity    = major - this -> minor;
+
+    this -> parametrise ();
+    this -> update ();
     return;
 }
 
@@ -46,7 +46,7 @@
  * Set this ellipse's minor to `0.f`.
  */
 
-inline void Ellipse :: set_minor (void)
+ELLIPSE_INLINE void Ellipse :: set_minor (void)
 {
     this -> set_minor (0.f);
     return;
@@ -60,11 +60,23 @@ inline void Ellipse :: set_minor (void)
  *
  * Since `minor` is a private attribute, it should be set exclusively using this
  * method.
+ *
+ * The minor semi-axis is the radius of this ellipse.  The major semi-axis is
+ * kept such that the eccentricity, being the difference of both semi-axes,
+ * changes accordingly.  The coordinate functions are rebuilt and the derived
+ * data is updated according to the caching mode.
  */
 
-inline void Ellipse :: set_minor (const float minor)
+ELLIPSE_INLINE void Ellipse :: set_minor (const float minor)
 {
-    this -> minor = minor;
+    ELLIPSE_COUNT ("set_minor");
+
+    this -> minor           = minor;
+    this -> radius          = minor;
+    this -> eccentricity    = this -> major - minor;
+
+    this -> parametrise ();
+    this -> update ();
     return;
 }
 
@@ -46,7 +46,7 @@
  * Set this ellipse's normal to `0.f, 0.f, 0.f`.
  */
 
-inline void Ellipse :: set_normal (void)
+ELLIPSE_INLINE void Ellipse :: set_normal (void)
 {
     this -> set_normal (0.f, 0.f, 0.f);
     return;
@@ -62,7 +62,7 @@ inline void Ellipse :: set_normal (void)
  * this method.
  */
 
-inline void Ellipse :: set_normal (const vector <float> & normal)
+ELLIPSE_INLINE void Ellipse :: set_normal (const vector <float> & normal)
 {
     switch (normal.size ())
     {
@@ -96,13 +96,20 @@ inline void Ellipse :: set_normal (const vector <float> & normal)
  *
  * Since `normal` is a private attribute, it should be set exclusively using
  * this method.
+ *
+ * The derived data is updated according to the caching mode.
  */
 
-inline void Ellipse :: set_normal (const float x, const float y, const float z)
+ELLIPSE_INLINE
+void Ellipse :: set_normal (const float x, const float y, const float z)
 {
+    ELLIPSE_COUNT ("set_normal");
+
     this -> normal[0x0] = x;
     this -> normal[0x1] = y;
     this -> normal[0x2] = z;
+
+    this -> update ();
     return;
 }
 
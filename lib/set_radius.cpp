@@ -46,7 +46,7 @@
  * Set this ellipse's radius to `0.f`.
  */
 
-inline void Ellipse :: set_radius (void)
+ELLIPSE_INLINE void Ellipse :: set_radius (void)
 {
     this -> set_radius (0.f);
     return;
@@ -60,11 +60,23 @@ inline void Ellipse :: set_radius (void)
  *
  * Since `radius` is a private attribute, it should be set exclusively using
  * this method.
+ *
+ * The radius is the minor semi-axis of this ellipse.  The eccentricity is kept
+ * such that the major semi-axis exceeds the minor one by it, as for the
+ * parametric constructor.  The coordinate functions are rebuilt and the
+ * derived data is updated according to the caching mode.
  */
 
-inline void Ellipse :: set_radius (const float radius)
+ELLIPSE_INLINE void Ellipse :: set_radius (const float radius)
 {
-    this -> radius = radius;
+    ELLIPSE_COUNT ("set_radius");
+
+    this -> radius  = radius;
+    this -> minor   = radius;
+    this -> major   = radius + this -> eccentricity;
+
+    this -> parametrise ();
+    this -> update ();
     return;
 }
 
@@ -46,7 +46,7 @@
  * Set this ellipse's tangent to `0.f, 0.f, 0.f`.
  */
 
-inline void Ellipse :: set_tangent (void)
+ELLIPSE_INLINE void Ellipse :: set_tangent (void)
 {
     this -> set_tangent (0.f, 0.f, 0.f);
     return;
@@ -62,7 +62,7 @@ inline void Ellipse :: set_tangent (void)
  * this method.
  */
 
-inline void Ellipse :: set_tangent (const vector <float> & tangent)
+ELLIPSE_INLINE void Ellipse :: set_tangent (const vector <float> & tangent)
 {
     switch (tangent.size ())
     {
@@ -96,13 +96,20 @@ inline void Ellipse :: set_tangent (const vector <float> & tangent)
  *
  * Since `tangent` is a private attribute, it should be set exclusively using
  * this method.
+ *
+ * The derived data is updated according to the caching mode.
  */
 
-inline void Ellipse :: set_tangent (const float x, const float y, const float z)
+ELLIPSE_INLINE
+void Ellipse :: set_tangent (const float x, const float y, const float z)
 {
+    ELLIPSE_COUNT ("set_tangent");
+
     this -> tangent[0x0] = x;
     this -> tangent[0x1] = y;
     this -> tangent[0x2] = z;
+
+    this -> update ();
     return;
 }
 
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Shade the pixels around the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        shade.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Overlays require anti-aliased edges and machine learning applications often
+ * train on soft masks or signed distance fields instead of binary masks.  This
+ * file defines the private kernel which computes both quantities for all pixels
+ * within the bounding box of the ellipse.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+
+
+
+/**
+ * \brief   Shade the pixels of this ellipse within a certain band.
+ * \param   image   The pixel buffer to write to.
+ * \param   mode    Either `coverage` or `distance`.
+ * \param   first   The first row of the band.
+ * \param   last    The row after the last one of the band.
+ *
+ * Relative to the centre and rotated into the axes of the ellipse, each pixel
+ * centre `(u, v)` has the normalised radius `r = sqrt (u^2 / a^2 + v^2 / b^2)`.
+ * The implicit function `r - 1` vanishes on the ellipse.  Dividing it by the
+ * length of its gradient yields the approximate signed distance in pixels,
+ * which is exact on the ellipse, at its centre and outside of it along both
+ * axes.  It is negative inside and bounded by the negative semi-minor axis
+ * there, which is the least possible distance and is assigned to the centre.
+ *
+ * The coverage of a pixel is estimated as `0.5 - distance`, clamped to the unit
+ * interval.  This corresponds to the area of the pixel covered by the tangent
+ * of the ellipse.  The estimate assumes that the radius of curvature is large
+ * compared to a pixel.  Otherwise, the tangent cuts off too little and the
+ * total coverage exceeds the area `pi a b` of the ellipse, by about 7% for a
+ * semi-minor axis of one pixel, 35% for half a pixel and still 2.5% for two
+ * pixels.  Hence, ellipses whose semi-minor axis is less than four pixels are
+ * summed up in a first pass over their whole bounding box, including the pixels
+ * outside of the image and the band, and their coverage is scaled to the
+ * analytic area.  Their total coverage is then exact, while the distribution
+ * among the pixels remains an approximation.  Ellipses which are so small that
+ * no pixel centre is closer than half a pixel to them are not visible.
+ *
+ * All pixels whose centre lies within the bounding box of the ellipse,
+ * enlarged by one pixel, are processed row by row in blocks of 256 pixels in
+ * SIMD lanes.  The results are combined with the current pixel values:
+ *
+ *  - 32-bit images are treated as `float` and keep the maximal coverage or the
+ *    minimal distance.
+ *  - 8-bit images store the coverage scaled to 255 and the distance shifted by
+ *    128, saturated to the range of a byte, and keep the maximum or minimum,
+ *    respectively.
+ *
+ * Hence, distance images need to be initialised with a large value, at least
+ * 255 or `FLT_MAX`, by the caller.
+ */
+
+ELLIPSE_INLINE void Ellipse :: shade  ( const Image & image
+                                      , const Rasterisation mode
+                                      , const size_t first
+                                      , const size_t last
+                                      ) const
+{
+    float   width   {0.f};
+    float   height  {0.f};
+
+    this -> extent (width, height);
+
+    const double    tx      {this -> tangent[0x0]};
+    const double    ty      {this -> tangent[0x1]};
+    const double    norm    {sqrt (tx * tx + ty * ty)};
+    const float     c       {float (norm > 0. ? tx / norm : 1.)};
+    const float     s       {float (norm > 0. ? ty / norm : 0.)};
+    const float     cx      {this -> centre[0x0]};
+    const float     cy      {this -> centre[0x1]};
+    const float     ia      {1.f / this -> major};
+    const float     ib      {1.f / this -> minor};
+    const float     inner   {- std :: min (this -> major, this -> minor)};
+
+    const double    columns {double (image.width)};
+    const double    left    {std :: max (std :: ceil (cx - width - 1.5), 0.)};
+    const double    right
+        {std :: min (std :: floor (cx + width + 0.5), columns - 1.)};
+    const double    top
+        {std :: max (std :: ceil (cy - height - 1.5), double (first))};
+    const double    bottom
+        {std :: min (std :: floor (cy + height + 0.5), double (last) - 1.)};
+
+    if (left > right)
+        return;
+
+    const size_t    begin   {size_t (left)};
+    const size_t    end     {size_t (right) + 0x1};
+    const bool      words   {image.depth == 0x20};
+
+    unsigned char * const   pixels
+        {static_cast <unsigned char *> (image.pixels)};
+
+    const auto  distances   = [&]   ( const float dy
+                                    , const float x0
+                                    , const size_t count
+                                    , float * value
+                                    )
+    {
+#pragma omp simd
+        for (size_t i = 0x0; i < count; i++)
+        {
+            const float dx  {x0 + float (int (i))};
+            const float u   {(dx * c + dy * s) * ia};
+            const float v   {(dy * c - dx * s) * ib};
+            const float r   {sqrt (u * u + v * v)};
+            const float g   {sqrt (u * u * ia * ia + v * v * ib * ib)};
+
+            const float d   {(r - 1.f) * r / g};
+
+            value[i] = d > inner ? d : inner;
+        };
+
+        return;
+    };
+
+    float   scale   {1.f};
+
+    if (mode == Ellipse :: coverage && - inner < 4.f)
+    {
+        const double    area    {3.141592654 * this -> major * this -> minor};
+        double          total   {0.};
+
+        for ( double row = std :: ceil (cy - height - 1.5)
+            ; row <= std :: floor (cy + height + 0.5)
+            ; row++
+            )
+            for ( double column = std :: ceil (cx - width - 1.5)
+                ; column <= std :: floor (cx + width + 0.5)
+                ; column += 256.
+                )
+            {
+                const size_t    count
+                    {size_t (std :: min ( std :: floor (cx + width + 0.5)
+                                        - column + 1.
+                                        , 256.
+                                        ))
+                    };
+                float           value   [0x100];
+
+                distances   ( float (row) + 0.5f - cy
+                            , float (column) + 0.5f - cx
+                            , count
+                            , value
+                            );
+
+                for (size_t i = 0x0; i < count; i++)
+                    total
+                        += std :: min (std :: max (0.5f - value[i], 0.f), 1.f);
+            };
+
+        if (total > 0.)
+            scale = float (area / total);
+    };
+
+    for (double row = top; row <= bottom; row++)
+    {
+        unsigned char * const   line    {pixels + size_t (row) * image.stride};
+        float * const           floats  {reinterpret_cast <float *> (line)};
+        const float             dy      {float (row) + 0.5f - cy};
+
+        for (size_t start = begin; start < end; start += 0x100)
+        {
+            const size_t    count   {std :: min (end - start, size_t (0x100))};
+            float           value   [0x100];
+            unsigned char   bytes   [0x100];
+            const float     x0      {float (start) + 0.5f - cx};
+
+            distances (dy, x0, count, value);
+
+            float * const           f   {floats + start};
+            unsigned char * const   p   {line + start};
+
+            if (mode == Ellipse :: coverage)
+            {
+#pragma omp simd
+                for (size_t i = 0x0; i < count; i++)
+                {
+                    const float covered {0.5f - value[i]};
+                    const float bounded {covered > 0.f ? covered : 0.f};
+                    const float clamped {bounded < 1.f ? bounded : 1.f};
+                    const float scaled  {clamped * scale};
+
+                    value[i] = scaled < 1.f ? scaled : 1.f;
+                    bytes[i] = static_cast <unsigned char> (255.f * value[i]);
+                };
+
+                for (size_t i = 0x0; i < count && words; i++)
+                    f[i] = std :: max (f[i], value[i]);
+
+                for (size_t i = 0x0; i < count && ! words; i++)
+                    p[i] = std :: max (p[i], bytes[i]);
+            }
+            else
+            {
+#pragma omp simd
+                for (size_t i = 0x0; i < count; i++)
+                {
+                    const float shifted {value[i] + 128.f};
+
+                    bytes[i] = static_cast <unsigned char>
+                        (std :: min (std :: max (shifted, 0.f), 255.f));
+                };
+
+                for (size_t i = 0x0; i < count && words; i++)
+                    f[i] = std :: min (f[i], value[i]);
+
+                for (size_t i = 0x0; i < count && ! words; i++)
+                    p[i] = std :: min (p[i], bytes[i]);
+            };
+        };
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Store the parameters of a planar ellipse in a batch.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        store.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Several batch algorithms result in ellipses within the x-y plane, for
+ * instance the conversion of conics and the perspective projection.  This file
+ * defines the private helper which writes such an ellipse into the arrays of a
+ * batch.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Store the parameters of a planar ellipse in a batch.
+ * \param   ellipses    The batch to write to.
+ * \param   i           The index of the ellipse within the batch.
+ * \param   valid       Whether the parameters describe a real ellipse.
+ * \param   parameters  The centre's coordinates, the semi-axes and the angle.
+ *
+ * The ellipse is stored within the x-y plane.  Its normal is the z axis and
+ * its tangent points into the direction of the major axis.  In case the
+ * parameters are not valid, all values are set to zero.
+ */
+
+ELLIPSE_INLINE void Ellipse :: store  ( const Batch & ellipses
+                                      , const size_t i
+                                      , const bool valid
+                                      , const double (& parameters) [0x5]
+                                      )
+{
+    const double    angle   {parameters[0x4]};
+
+    ellipses.centre[0x0][i]     = valid ? float (parameters[0x0]) : 0.f;
+    ellipses.centre[0x1][i]     = valid ? float (parameters[0x1]) : 0.f;
+    ellipses.centre[0x2][i]     = 0.f;
+    ellipses.tangent[0x0][i]    = valid ? float (cos (angle)) : 0.f;
+    ellipses.tangent[0x1][i]    = valid ? float (sin (angle)) : 0.f;
+    ellipses.tangent[0x2][i]    = 0.f;
+    ellipses.normal[0x0][i]     = 0.f;
+    ellipses.normal[0x1][i]     = 0.f;
+    ellipses.normal[0x2][i]     = valid ? 1.f : 0.f;
+    ellipses.major[i]           = valid ? float (parameters[0x2]) : 0.f;
+    ellipses.minor[i]           = valid ? float (parameters[0x3]) : 0.f;
+
+    return;
+}
+
+/******************************************************************************/
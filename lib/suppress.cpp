@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Non-maximum suppression of overlapping ellipses.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        suppress.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Detectors emit many overlapping candidates for the same object.  This file
+ * defines the greedy non-maximum suppression of such candidates by their
+ * intersection over union.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+
+
+
+/**
+ * \brief   Suppress overlapping ellipses which are not the best ones.
+ * \param   ellipses    The candidates.
+ * \param   scores      The scores of the candidates.
+ * \param   count       The count of candidates.
+ * \param   threshold   The greatest intersection over union to tolerate.
+ * \param   kept        The indices of the kept candidates.
+ * \param   threads     The count of threads to use, or zero for all cores.
+ * \return  The count of kept candidates.
+ *
+ * This is the greedy non-maximum suppression:  the candidates are visited in
+ * descending order of their scores, ties broken by their indices.  A candidate
+ * is kept unless it overlaps a kept one with an intersection over union above
+ * the threshold.  The kept indices are stored in the order of visiting, hence,
+ * `kept` needs to provide up to `count` elements.
+ *
+ * Instead of comparing each visited candidate with all kept ones, all pairs
+ * exceeding the threshold are determined in advance.  At first, the bounding
+ * boxes are swept along the x axis such that only pairs of overlapping boxes
+ * are considered.  The intersection of two ellipses is not greater than the
+ * one of their boxes nor than each of their areas, which bounds the
+ * intersection over union from above.  Only pairs whose bound exceeds the
+ * threshold are checked by `overlap`.  The sweep is processed in chunks of 256
+ * candidates which are distributed dynamically among the threads.  Then, the
+ * greedy pass only follows the pairs of the kept candidates.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: suppress ( const Ellipse * ellipses
+                                          , const float * scores
+                                          , const size_t count
+                                          , const float threshold
+                                          , size_t * kept
+                                          , const size_t threads
+                                          )
+{
+    ELLIPSE_COUNT ("suppress (batch)");
+    ELLIPSE_TIME ("suppress (batch)");
+
+    typedef std :: pair <size_t, size_t>    Pair;
+
+    ELLIPSE_ALLOCATE ( count * (0x2 * sizeof (size_t) + sizeof (Planar))
+                     + count * (sizeof (double) + 0x8 * sizeof (float))
+                     );
+
+    vector <size_t> order   (count);
+    vector <size_t> sweep   (count);
+    vector <Planar> shapes  (count);
+    vector <double> area    (count);
+    vector <float>  box     (0x4 * count);
+    vector <float>  swept   (0x4 * count);
+
+    for (size_t i = 0x0; i < count; i++)
+        order[i] = i;
+
+    std :: sort ( order.begin ()
+                , order.end ()
+                , [scores] (const size_t i, const size_t j) -> bool
+                {
+                    return scores[i] > scores[j]
+                        || (scores[i] == scores[j] && i < j);
+                }
+                );
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const Ellipse & ellipse {ellipses[order[i]]};
+        float           width   {0.f};
+        float           height  {0.f};
+
+        ellipse.extent (width, height);
+
+        shapes[i]           = ellipse.planar ();
+        area[i]             = 3.141592653589793
+                            * shapes[i].major * shapes[i].minor;
+        box[0x4 * i]        = float (shapes[i].cx) - width;
+        box[0x4 * i + 0x1]  = float (shapes[i].cx) + width;
+        box[0x4 * i + 0x2]  = float (shapes[i].cy) - height;
+        box[0x4 * i + 0x3]  = float (shapes[i].cy) + height;
+        sweep[i]            = i;
+    };
+
+    std :: sort ( sweep.begin ()
+                , sweep.end ()
+                , [&box] (const size_t i, const size_t j) -> bool
+                {
+                    return box[0x4 * i] < box[0x4 * j];
+                }
+                );
+
+    for (size_t k = 0x0; k < 0x4 * count; k++)
+        swept[k] = box[0x4 * sweep[k / 0x4] + k % 0x4];
+
+    const size_t            size    {0x100};
+    const size_t            chunks  {(count + size - 0x1) / size};
+    const size_t            cores   {std :: thread :: hardware_concurrency ()};
+    const size_t            wanted  {threads ? threads : cores ? cores : 0x1};
+    const size_t            workers
+        {chunks ? std :: min (wanted, chunks) : 0x1};
+    vector <vector <Pair>>  pairs   (workers);
+    std :: atomic <size_t>  next    {0x0};
+
+    const auto  work    = [&] (const size_t worker) -> void
+    {
+        for (size_t chunk = next++; chunk < chunks; chunk = next++)
+        {
+            const size_t    end {std :: min ((chunk + 0x1) * size, count)};
+
+            for (size_t k = chunk * size; k < end; k++)
+            {
+                const float *   a   {swept.data () + 0x4 * k};
+
+                for (size_t l = k + 0x1; l < count; l++)
+                {
+                    const float *   b   {swept.data () + 0x4 * l};
+
+                    if (b[0x0] > a[0x1])
+                        break;
+
+                    if (! (b[0x2] < a[0x3] && a[0x2] < b[0x3]))
+                        continue;
+
+                    const size_t    i   {sweep[k]};
+                    const size_t    j   {sweep[l]};
+                    const double    w
+                        {std :: min (a[0x1], b[0x1]) - b[0x0]};
+                    const double    h
+                        { std :: min (a[0x3], b[0x3])
+                        - std :: max (a[0x2], b[0x2])
+                        };
+
+                    const double    bound
+                        {std :: min (w * h, std :: min (area[i], area[j]))};
+
+                    if (! (bound > threshold * (area[i] + area[j] - bound)))
+                        continue;
+
+                    const double    common
+                        {Ellipse :: overlap (shapes[i], shapes[j])};
+
+                    if (common > threshold * (area[i] + area[j] - common))
+                        pairs[worker].push_back
+                            (Pair (std :: min (i, j), std :: max (i, j)));
+                };
+            };
+        };
+
+        return;
+    };
+
+    vector <std :: thread>  pool    {};
+
+    for (size_t i = 0x1; i < workers; i++)
+        pool.emplace_back (work, i);
+
+    work (0x0);
+
+    for (std :: thread & thread : pool)
+        thread.join ();
+
+    for (size_t i = 0x0; i < workers; i++)
+        ELLIPSE_ALLOCATE (pairs[i].capacity () * sizeof (Pair));
+
+    vector <Pair> & all {pairs[0x0]};
+
+    for (size_t i = 0x1; i < workers; i++)
+        all.insert (all.end (), pairs[i].begin (), pairs[i].end ());
+
+    ELLIPSE_ALLOCATE (all.size () * sizeof (Pair));
+
+    std :: sort (all.begin (), all.end ());
+
+    vector <bool>   suppressed  (count, false);
+    size_t          edge        {0x0};
+    size_t          ret         {0x0};
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const bool  keep    {! suppressed[i]};
+
+        if (keep)
+            kept[ret++] = order[i];
+
+        for (; edge < all.size () && all[edge].first == i; edge++)
+            if (keep)
+                suppressed[all[edge].second] = true;
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Tessellate the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        tessellate.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Renderers approximate ellipses by closed polylines.  Since scenes often
+ * contain many ellipses of the same shape, the tessellation can be taken from a
+ * cache of shapes, leaving only the placement of the vertices.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Tessellate this ellipse.
+ * \param   tolerance   The maximal deviation of the polyline from the curve.
+ * \param   x           The x coordinates of the vertices.
+ * \param   y           The y coordinates of the vertices.
+ * \param   z           The z coordinates of the vertices.
+ * \return  The count of vertices of the closed polyline.
+ *
+ * The shape is tessellated by `Tessellation :: canonical` and placed in space
+ * by the centre, the tangent and the normal of this ellipse.  As the count of
+ * vertices is capped at 65536, very elongated ellipses may exceed `tolerance`;
+ * the achieved deviation is reported by the polyline of the cache.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: tessellate   ( const float tolerance
+                                              , vector <float> & x
+                                              , vector <float> & y
+                                              , vector <float> & z
+                                              ) const
+{
+    ELLIPSE_COUNT ("tessellate");
+
+    return this -> place
+        ( Tessellation :: canonical (this -> major, this -> minor, tolerance)
+        , x
+        , y
+        , z
+        );
+}
+
+
+
+/**
+ * \brief   Tessellate this ellipse using a cache of shapes.
+ * \param   cache       The cache of tessellated shapes.
+ * \param   tolerance   The maximal deviation of the polyline from the curve.
+ * \param   x           The x coordinates of the vertices.
+ * \param   y           The y coordinates of the vertices.
+ * \param   z           The z coordinates of the vertices.
+ * \return  The count of vertices of the closed polyline.
+ *
+ * The result is the same as without a cache.  In case the shape was
+ * tessellated before, only the placement remains to be done.  The cache may be
+ * shared among threads.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: tessellate   ( Tessellation & cache
+                                              , const float tolerance
+                                              , vector <float> & x
+                                              , vector <float> & y
+                                              , vector <float> & z
+                                              ) const
+{
+    ELLIPSE_COUNT ("tessellate (cached)");
+
+    const std :: shared_ptr <const Tessellation :: Polyline>    polyline
+        {cache.lookup (this -> major, this -> minor, tolerance)};
+
+    return this -> place (* polyline, x, y, z);
+}
+
+/******************************************************************************/
@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Tessellate offset curves of the considered ellipse.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        tessellate_offset.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Offset curves can be approximated by closed polylines whose vertices lie on
+ * the exact offset curve.  This is required for tool paths in CNC machining as
+ * well as for the outlines of strokes.
+ *
+ * Inner offsets at a distance greater than the least radius of curvature
+ * contain cusps and small loops, the so-called swallowtails, which are not part
+ * of the region at the requested distance.  They are trimmed by the
+ * tessellation.  The polylines are placed in space like the tessellation of the
+ * ellipse itself and stored as separate arrays of coordinates.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+
+
+
+/**
+ * \brief   Tessellate an offset curve of this ellipse.
+ * \param   distance    The signed normal distance to the ellipse.
+ * \param   tolerance   The maximal deviation of the polyline from the curve.
+ * \param   x           The x coordinates of the vertices.
+ * \param   y           The y coordinates of the vertices.
+ * \param   z           The z coordinates of the vertices.
+ * \return  The count of vertices of the closed polyline.
+ *
+ * This overload calls the batch overload for a single distance.  See there for
+ * the details.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: tessellate_offset    ( const float distance
+                                                      , const float tolerance
+                                                      , vector <float> & x
+                                                      , vector <float> & y
+                                                      , vector <float> & z
+                                                      ) const
+{
+    ELLIPSE_COUNT ("tessellate_offset");
+
+    size_t  ret {0x0};
+
+    this -> tessellate_offset (& distance, 0x1, tolerance, x, y, z, & ret);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Tessellate several offset curves of this ellipse.
+ * \param   distances   The signed normal distances to the ellipse.
+ * \param   offsets     The count of distances.
+ * \param   tolerance   The maximal deviation of the polylines from the curves.
+ * \param   x           The x coordinates of the vertices.
+ * \param   y           The y coordinates of the vertices.
+ * \param   z           The z coordinates of the vertices.
+ * \param   counts      The counts of vertices per closed polyline.
+ * \return  The count of vertices of all polylines.
+ *
+ * This overload is intended for tool paths which consist of many offset
+ * passes of the same ellipse.  The polylines are stored one after another in
+ * the output vectors, which are resized to the total count of vertices, in the
+ * order of `distances`.  `counts` needs to provide space for `offsets`
+ * elements.  The vertices are placed in space by the centre, the tangent and
+ * the normal of this ellipse, just as by `tessellate`.
+ *
+ * All offset curves share the same parameter values such that the sines and
+ * cosines are computed only once by the batch overload of `eval_offset`.  Their
+ * count is chosen such that the sagitta of each segment does not exceed
+ * `tolerance`, assuming the greatest curvature of the ellipse and the speed of
+ * the farthest offset curve.  Hence, nearer offset curves are tessellated
+ * finer than required.
+ *
+ * For inner offsets, each vertex is checked whether its exact distance to the
+ * ellipse is at least the requested one.  Vertices which are closer belong to
+ * swallowtails and are removed.  The remaining runs of vertices are joined at
+ * the self-intersection points of the polyline such that only the boundary of
+ * the points which keep the requested distance to the ellipse remains.  In
+ * case an inner offset vanishes, its count of vertices is zero.
+ */
+
+ELLIPSE_INLINE size_t Ellipse :: tessellate_offset    ( const float * distances
+                                                      , const size_t offsets
+                                                      , const float tolerance
+                                                      , vector <float> & x
+                                                      , vector <float> & y
+                                                      , vector <float> & z
+                                                      , size_t * counts
+                                                      ) const
+{
+    ELLIPSE_COUNT ("tessellate_offset (batch)");
+    ELLIPSE_TIME ("tessellate_offset (batch)");
+
+    Tessellation :: Polyline    local   {};
+
+    const float major   {std :: max (this -> major, this -> minor)};
+    const float minor   {std :: min (this -> major, this -> minor)};
+
+    float   reach   {-1.f};
+
+    for (size_t j = 0x0; j < offsets; j++)
+    {
+        counts[j] = 0x0;
+
+        if (distances[j] > - minor)
+            reach = std :: max (reach, abs (distances[j]));
+    };
+
+    if (minor <= 0.f || reach < 0.f || ! (tolerance > 0.f))
+        return this -> place (local, x, y, z);
+
+    const double    speed       {major + reach};
+    const double    curvature   {major / (minor * minor)};
+    const double    step
+        {sqrt (8. * tolerance / (speed * speed * curvature))};
+    const size_t    count
+        {size_t (std :: min (std :: max (std :: ceil (6.283185307 / step), 16.)
+                            , 65536.
+                            ))
+        };
+
+    ELLIPSE_ALLOCATE ( (count + 0x5 * count * offsets) * sizeof (float)
+                     + (count + 0x7) / 0x8
+                     );
+
+    vector <float>  t       (count);
+    vector <float>  u       (count * offsets);
+    vector <float>  v       (count * offsets);
+    vector <float>  w       (count * offsets);
+    vector <bool>   valid   (count);
+
+    // Trimming replaces each run of removed vertices by a single one.  Hence,
+    // no polyline has more vertices than parameter values.
+    local.u.reserve (count * offsets);
+    local.v.reserve (count * offsets);
+
+    for (size_t i = 0x0; i < count; i++)
+        t[i] = float (6.283185307 * double (i) / double (count));
+
+    this -> eval_offset
+        (t.data (), count, distances, offsets, u.data (), v.data (), w.data ());
+
+    for (size_t j = 0x0; j < offsets; j++)
+    {
+        const float     distance    {distances[j]};
+        const float *   pu          {u.data () + j * count};
+        const float *   pv          {v.data () + j * count};
+        const size_t    begin       {local.u.size ()};
+
+        if (distance <= - minor)
+            continue;
+
+        const float slack   {1e-4f * (major + abs (distance))};
+        size_t      first   {count};
+
+        for (size_t i = 0x0; distance < 0.f && i < count; i++)
+        {
+            float   parameter   {0.f};
+
+            valid[i] = this -> closest (pu[i], pv[i], parameter)
+                     >= abs (distance) - slack;
+        };
+
+        for (size_t i = 0x0; distance < 0.f && first == count && i < count; i++)
+            if (valid[i] && ! valid[(i + count - 0x1) % count])
+                first = i;
+
+        if (distance >= 0.f || (first == count && valid[0x0]))
+        {
+            local.u.insert (local.u.end (), pu, pu + count);
+            local.v.insert (local.v.end (), pv, pv + count);
+            counts[j] = count;
+            continue;
+        };
+
+        for (size_t k = 0x0; first < count && k < count; k++)
+        {
+            const size_t    i   {(first + k) % count};
+
+            if (valid[i])
+            {
+                local.u.push_back (pu[i]);
+                local.v.push_back (pv[i]);
+                continue;
+            };
+
+            if (! valid[(i + count - 0x1) % count])
+                continue;
+
+            size_t  next    {(i + 0x1) % count};
+
+            while (! valid[next])
+                next = (next + 0x1) % count;
+
+            const size_t    a   {(i + count - 0x1) % count};
+            const size_t    c   {(next + count - 0x1) % count};
+
+            const double    ux  {double (pu[i]) - pu[a]};
+            const double    uy  {double (pv[i]) - pv[a]};
+            const double    vx  {double (pu[next]) - pu[c]};
+            const double    vy  {double (pv[next]) - pv[c]};
+            const double    wx  {double (pu[c]) - pu[a]};
+            const double    wy  {double (pv[c]) - pv[a]};
+            const double    det {ux * vy - uy * vx};
+            const double    r   {det != 0. ? (wx * vy - wy * vx) / det : -1.};
+
+            if (r >= 0. && r <= 1.)
+            {
+                local.u.push_back (float (pu[a] + r * ux));
+                local.v.push_back (float (pv[a] + r * uy));
+            }
+            else
+            {
+                local.u.push_back (0.5f * (pu[a] + pu[next]));
+                local.v.push_back (0.5f * (pv[a] + pv[next]));
+            };
+        };
+
+        counts[j] = local.u.size () - begin;
+    };
+
+    return this -> place (local, x, y, z);
+}
+
+/******************************************************************************/
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Convert a batch of ellipses into conics.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        to_conic.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * The conversion into the implicit form only requires a fixed count of
+ * operations per ellipse.  Hence, whole batches can be converted at once
+ * without allocating any memory.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Convert a batch of ellipses into conics.
+ * \param   ellipses    The ellipses to convert.
+ * \param   count       The count of ellipses.
+ * \param   conics      The resulting conics.
+ *
+ * Each ellipse is interpreted within the x-y plane in the same way as by
+ * `get_conic`.  `conics` needs to provide space for `count` elements.
+ */
+
+ELLIPSE_INLINE void Ellipse :: to_conic   ( const Batch & ellipses
+                                          , const size_t count
+                                          , Conic * conics
+                                          )
+{
+    ELLIPSE_COUNT ("to_conic (batch)");
+    ELLIPSE_TIME ("to_conic (batch)");
+
+    for (size_t i = 0x0; i < count; i++)
+        conics[i] = Conic :: from_parameters
+            ( ellipses.centre[0x0][i]
+            , ellipses.centre[0x1][i]
+            , ellipses.major[i]
+            , ellipses.minor[i]
+            , std :: atan2 (ellipses.tangent[0x1][i], ellipses.tangent[0x0][i])
+            );
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Convert the considered ellipse into a NURBS curve.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        to_nurbs.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * CAD exchange formats such as IGES and STEP describe conic sections by non-
+ * uniform rational B-splines.  This file defines the exact conversion of an
+ * ellipse into such a curve.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Convert this ellipse into a NURBS curve.
+ * \return  The closed curve of degree two.
+ *
+ * The curve consists of the four rational quadratic segments of
+ * `to_rational_bezier`, as usual for circles in CAD exchange formats.  Hence,
+ * there are nine control points with the weights `1` and `sqrt (2) / 2`
+ * alternating, where the last control point repeats the first one.  The inner
+ * knots are doubled at the joints of the segments such that the knot vector
+ * is `(0, 0, 0, 1/4, 1/4, 1/2, 1/2, 3/4, 3/4, 1, 1, 1)`.
+ */
+
+ELLIPSE_INLINE Ellipse :: Nurbs Ellipse :: to_nurbs (void) const
+{
+    ELLIPSE_COUNT ("to_nurbs");
+
+    const size_t            segments    {0x4};
+    const vector <Bezier>   beziers     {this -> to_rational_bezier (segments)};
+    Nurbs                   ret         {};
+
+    ELLIPSE_ALLOCATE ((0x3 * segments + 0x3) * sizeof (float));
+    ELLIPSE_ALLOCATE ((0x2 * segments + 0x1) * sizeof (array <float, 0x3>));
+
+    ret.degree = 0x2;
+    ret.knots.assign (0x3, 0.f);
+
+    for (size_t k = 0x0; k < segments; k++)
+    {
+        const Bezier &  bezier  {beziers[k]};
+
+        for (size_t p = 0x0; p < 0x2; p++)
+        {
+            ret.points.push_back (array <float, 0x3>
+                { { bezier.points[p][0x0]
+                  , bezier.points[p][0x1]
+                  , bezier.points[p][0x2]
+                  }
+                });
+            ret.weights.push_back (bezier.weights[p]);
+        };
+
+        if (k + 0x1 < segments)
+            ret.knots.insert (ret.knots.end (), 0x2
+                             , float (k + 0x1) / float (segments)
+                             );
+    };
+
+    ret.points.push_back (ret.points.front ());
+    ret.weights.push_back (ret.weights.front ());
+    ret.knots.insert (ret.knots.end (), 0x3, 1.f);
+
+    return ret;
+}
+
+/******************************************************************************/
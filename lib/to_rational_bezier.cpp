@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Convert ellipses into rational quadratic Bezier segments.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        to_rational_bezier.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Rasterisers without fast trigonometric functions and CAD exporters describe
+ * conic arcs by rational quadratic segments.  This file defines the exact
+ * conversion of ellipses into such segments, both for single ellipses and for
+ * whole batches.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Convert this ellipse into rational quadratic segments.
+ * \param   segments    The count of segments, at least three.
+ * \return  The segments in the order of the parametrisation.
+ *
+ * See the batch overload for details.  In case there are less than three
+ * segments, no segments are returned.
+ */
+
+ELLIPSE_INLINE
+vector <Bezier> Ellipse :: to_rational_bezier (const size_t segments) const
+{
+    ELLIPSE_COUNT ("to_rational_bezier");
+
+    if (segments < 0x3)
+        return vector <Bezier> {};
+
+    ELLIPSE_ALLOCATE (segments * sizeof (Bezier));
+
+    vector <Bezier> ret (segments);
+
+    Ellipse :: to_rational_bezier (this, 0x1, segments, ret.data ());
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Convert a batch of ellipses into rational quadratic segments.
+ * \param   ellipses    The ellipses to convert.
+ * \param   count       The count of ellipses.
+ * \param   segments    The count of segments per ellipse, at least three.
+ * \param   beziers     The segments, `segments` per ellipse.
+ *
+ * Segment `k` represents the arc between the parameters `2 pi k / n` and
+ * `2 pi (k + 1) / n` exactly, where `n` is the count of segments.  For a unit
+ * circle, the arc of the angle `d` is given by its end points, the
+ * intersection of their tangents and the weights `1`, `cos (d / 2)` and `1`.
+ * Since rational segments are invariant under affine maps, the control points
+ * are mapped into space by the semi-axes, the basis and the centre of the
+ * ellipse while the weights are kept.  Hence, the segments include the
+ * orientation of the ellipse in space.
+ *
+ * The segments share their end points with the ellipse, but the speed of
+ * their parametrisation differs from the ellipse's one in between.  Since the
+ * intersection of the tangents moves to infinity for an angle of 180 degrees,
+ * at least three segments are required.  Otherwise, nothing is written.
+ */
+
+ELLIPSE_INLINE void Ellipse :: to_rational_bezier ( const Ellipse * ellipses
+                                                  , const size_t count
+                                                  , const size_t segments
+                                                  , Bezier * beziers
+                                                  )
+{
+    ELLIPSE_COUNT ("to_rational_bezier (batch)");
+    ELLIPSE_TIME ("to_rational_bezier (batch)");
+
+    if (segments < 0x3)
+        return;
+
+    ELLIPSE_ALLOCATE (0x4 * (segments + 0x1) * sizeof (double));
+
+    const double    delta   {6.283185307179586 / double (segments)};
+    const double    weight  {cos (0.5 * delta)};
+    vector <double> cosine  (segments + 0x1);
+    vector <double> sine    (segments + 0x1);
+    vector <double> middle  [0x2];
+
+    middle[0x0].resize (segments);
+    middle[0x1].resize (segments);
+
+    for (size_t k = 0x0; k <= segments; k++)
+    {
+        cosine[k]   = cos (delta * double (k));
+        sine[k]     = sin (delta * double (k));
+
+        if (k == segments)
+            break;
+
+        middle[0x0][k]  = cos (delta * (double (k) + 0.5)) / weight;
+        middle[0x1][k]  = sin (delta * (double (k) + 0.5)) / weight;
+    };
+
+    for (size_t i = 0x0; i < count; i++)
+    {
+        const Ellipse & ellipse {ellipses[i]};
+        double          u       [0x3]   {};
+        double          v       [0x3]   {};
+
+        ellipse.basis (u, v);
+
+        const double    a   {ellipse.major};
+        const double    b   {ellipse.minor};
+
+        for (size_t k = 0x0; k < segments; k++)
+        {
+            Bezier &        bezier  {beziers[i * segments + k]};
+            const double    local   [0x3][0x2]
+                { {a * cosine[k], b * sine[k]}
+                , {a * middle[0x0][k], b * middle[0x1][k]}
+                , {a * cosine[k + 0x1], b * sine[k + 0x1]}
+                };
+
+            for (size_t p = 0x0; p < 0x3; p++)
+                for (size_t c = 0x0; c < 0x3; c++)
+                    bezier.points[p][c] = float ( ellipse.centre[c]
+                                                + local[p][0x0] * u[c]
+                                                + local[p][0x1] * v[c]
+                                                );
+
+            bezier.weights[0x0] = 1.f;
+            bezier.weights[0x1] = float (weight);
+            bezier.weights[0x2] = 1.f;
+        };
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Apply an affine transformation to a batch of ellipses.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        transform.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * Moving, scaling or rotating a whole scene of ellipses would require five
+ * setter calls per ellipse, otherwise.  Instead, the batch kernel updates the
+ * centres and the axes of all ellipses in one SIMD pass and distributes large
+ * batches among several threads.
+ *
+ * The image of an ellipse under an affine map is an ellipse, again.  However,
+ * the images of its axes are in general no longer orthogonal in case the map
+ * contains a non-uniform scaling or a shear.  Hence, the axes are determined
+ * anew from the two conjugate semi-diameters the original axes are mapped to.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+
+
+/**
+ * \brief   Apply an affine transformation to a batch of ellipses.
+ * \param   affine      The 3x4 matrix of the transformation in row-major order.
+ * \param   ellipses    The ellipses to transform.
+ * \param   count       The count of ellipses.
+ * \param   results     The transformed ellipses.
+ * \param   threads     The count of threads to use, or zero for all cores.
+ *
+ * The left 3x3 block of `affine` is the linear part of the transformation and
+ * the last column is the translation.  The batch is divided into chunks of
+ * 16384 ellipses which are distributed dynamically among the threads.  Hence,
+ * small batches are processed by the calling thread, only.
+ *
+ * `results` may refer to the same arrays as `ellipses`.
+ */
+
+ELLIPSE_INLINE void Ellipse :: transform  ( const float * affine
+                                          , const Batch & ellipses
+                                          , const size_t count
+                                          , const Batch & results
+                                          , const size_t threads
+                                          )
+{
+    ELLIPSE_COUNT ("transform (batch)");
+    ELLIPSE_TIME ("transform (batch)");
+
+    const size_t            size    {0x4000};
+    const size_t            chunks  {(count + size - 0x1) / size};
+    std :: atomic <size_t>  next    {0x0};
+
+    const auto  work    = [&] (void) -> void
+    {
+        for (size_t chunk = next++; chunk < chunks; chunk = next++)
+            Ellipse :: transform
+                ( affine
+                , ellipses
+                , results
+                , chunk * size
+                , std :: min ((chunk + 0x1) * size, count)
+                );
+
+        return;
+    };
+
+    const size_t            cores   {std :: thread :: hardware_concurrency ()};
+    const size_t            wanted  {threads ? threads : cores ? cores : 0x1};
+    const size_t            workers {std :: min (wanted, chunks)};
+    vector <std :: thread>  pool    {};
+
+    for (size_t i = 0x1; i < workers; i++)
+        pool.emplace_back (work);
+
+    work ();
+
+    for (std :: thread & thread : pool)
+        thread.join ();
+
+    return;
+}
+
+
+
+/**
+ * \brief   Apply an affine transformation to a range of a batch.
+ * \param   affine      The 3x4 matrix of the transformation in row-major order.
+ * \param   ellipses    The ellipses to transform.
+ * \param   results     The transformed ellipses.
+ * \param   first       The index of the first ellipse to transform.
+ * \param   last        The index after the last ellipse to transform.
+ *
+ * At first, the orthonormal basis `u`, `v` of each ellipse's plane is
+ * determined in the same way as by `basis`, but without branches such that the
+ * loop can be processed in SIMD lanes.  The semi-axes are mapped to the
+ * conjugate semi-diameters `U = a M u` and `V = b M v`.  The new semi-axes are
+ * the square roots of the eigenvalues of their Gram matrix and their
+ * directions follow from rotating the parametrisation by the angle given by
+ * the corresponding eigenvector.  Thus, the transformed tangent points into
+ * the direction of the new major axis.
+ *
+ * The new normal is the normalised cross product of `U` and `V`.  Hence, it is
+ * flipped by reflections.  In case the transformation collapses the ellipse
+ * into a line segment or a point, the original normal is kept and the tangent
+ * falls back to the original major axis.
+ */
+
+ELLIPSE_INLINE void Ellipse :: transform  ( const float * affine
+                                          , const Batch & ellipses
+                                          , const Batch & results
+                                          , const size_t first
+                                          , const size_t last
+                                          )
+{
+    const float m00 {affine[0x0]};
+    const float m01 {affine[0x1]};
+    const float m02 {affine[0x2]};
+    const float m10 {affine[0x4]};
+    const float m11 {affine[0x5]};
+    const float m12 {affine[0x6]};
+    const float m20 {affine[0x8]};
+    const float m21 {affine[0x9]};
+    const float m22 {affine[0xa]};
+    const float d0  {affine[0x3]};
+    const float d1  {affine[0x7]};
+    const float d2  {affine[0xb]};
+
+    // Local copies of the batches keep the array pointers in registers.
+    const Batch in  (ellipses);
+    const Batch out (results);
+
+#pragma omp simd
+    for (size_t i = first; i < last; i++)
+    {
+        const float cx  {in.centre[0x0][i]};
+        const float cy  {in.centre[0x1][i]};
+        const float cz  {in.centre[0x2][i]};
+        const float tx  {in.tangent[0x0][i]};
+        const float ty  {in.tangent[0x1][i]};
+        const float tz  {in.tangent[0x2][i]};
+        const float a   {in.major[i]};
+        const float b   {in.minor[i]};
+
+        const float mx  {in.normal[0x0][i]};
+        const float my  {in.normal[0x1][i]};
+        const float mz  {in.normal[0x2][i]};
+
+        const float ln  {sqrt (mx * mx + my * my + mz * mz)};
+        const float nx  {ln > 0.f ? mx / ln : 0.f};
+        const float ny  {ln > 0.f ? my / ln : 0.f};
+        const float nz  {ln > 0.f ? mz / ln : 1.f};
+
+        // The tangent, the x axis and the y axis, made orthogonal to the
+        // normal.
+        const float dt  {tx * nx + ty * ny + tz * nz};
+        const float t0  {tx - dt * nx};
+        const float t1  {ty - dt * ny};
+        const float t2  {tz - dt * nz};
+        const float x0  {1.f - nx * nx};
+        const float x1  {- nx * ny};
+        const float x2  {- nx * nz};
+        const float y0  {- ny * nx};
+        const float y1  {1.f - ny * ny};
+        const float y2  {- ny * nz};
+        const float lt  {sqrt (t0 * t0 + t1 * t1 + t2 * t2)};
+        const float lx  {sqrt (x0 * x0 + x1 * x1 + x2 * x2)};
+        const float ly  {sqrt (y0 * y0 + y1 * y1 + y2 * y2)};
+        const bool  kt  {lt > 1e-6f};
+        const bool  kx  {lx > 1e-6f};
+
+        const float lu  {kt ? lt : kx ? lx : ly};
+        const float u0  {(kt ? t0 : kx ? x0 : y0) / lu};
+        const float u1  {(kt ? t1 : kx ? x1 : y1) / lu};
+        const float u2  {(kt ? t2 : kx ? x2 : y2) / lu};
+        const float v0  {ny * u2 - nz * u1};
+        const float v1  {nz * u0 - nx * u2};
+        const float v2  {nx * u1 - ny * u0};
+
+        // The conjugate semi-diameters.
+        const float p0  {a * (m00 * u0 + m01 * u1 + m02 * u2)};
+        const float p1  {a * (m10 * u0 + m11 * u1 + m12 * u2)};
+        const float p2  {a * (m20 * u0 + m21 * u1 + m22 * u2)};
+        const float q0  {b * (m00 * v0 + m01 * v1 + m02 * v2)};
+        const float q1  {b * (m10 * v0 + m11 * v1 + m12 * v2)};
+        const float q2  {b * (m20 * v0 + m21 * v1 + m22 * v2)};
+
+        // The eigenvalues and the major eigenvector of the Gram matrix.
+        const float pp      {p0 * p0 + p1 * p1 + p2 * p2};
+        const float qq      {q0 * q0 + q1 * q1 + q2 * q2};
+        const float pq      {p0 * q0 + p1 * q1 + p2 * q2};
+        const float half    {0.5f * (pp - qq)};
+        const float spread  {sqrt (half * half + pq * pq)};
+        const float mean    {0.5f * (pp + qq)};
+        const float low     {mean - spread};
+        const float ex      {half >= 0.f ? half + spread : pq};
+        const float ey      {half >= 0.f ? pq : spread - half};
+        const float le      {sqrt (ex * ex + ey * ey)};
+        const float c       {le > 0.f ? ex / le : 1.f};
+        const float s       {le > 0.f ? ey / le : 0.f};
+
+        // The new major axis and the new normal.
+        const float w0  {c * p0 + s * q0};
+        const float w1  {c * p1 + s * q1};
+        const float w2  {c * p2 + s * q2};
+        const float lw  {sqrt (w0 * w0 + w1 * w1 + w2 * w2)};
+        const float r0  {p1 * q2 - p2 * q1};
+        const float r1  {p2 * q0 - p0 * q2};
+        const float r2  {p0 * q1 - p1 * q0};
+        const float lr  {sqrt (r0 * r0 + r1 * r1 + r2 * r2)};
+
+        out.centre[0x0][i]  = m00 * cx + m01 * cy + m02 * cz + d0;
+        out.centre[0x1][i]  = m10 * cx + m11 * cy + m12 * cz + d1;
+        out.centre[0x2][i]  = m20 * cx + m21 * cy + m22 * cz + d2;
+        out.tangent[0x0][i] = lw > 0.f ? w0 / lw : u0;
+        out.tangent[0x1][i] = lw > 0.f ? w1 / lw : u1;
+        out.tangent[0x2][i] = lw > 0.f ? w2 / lw : u2;
+        out.normal[0x0][i]  = lr > 0.f ? r0 / lr : nx;
+        out.normal[0x1][i]  = lr > 0.f ? r1 / lr : ny;
+        out.normal[0x2][i]  = lr > 0.f ? r2 / lr : nz;
+        out.major[i]        = sqrt (mean + spread);
+        out.minor[i]        = sqrt (low > 0.f ? low : 0.f);
+    };
+
+    return;
+}
+
+/******************************************************************************/
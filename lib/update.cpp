@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       Keep the derived data of the considered ellipse consistent.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        update.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * All setters which change the geometry of the ellipse call this method
+ * afterwards.  It applies the caching mode chosen by `set_caching`.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+#include "Ellipse.hpp"
+
+
+
+/**
+ * \brief   Apply the caching mode after a change of the geometry.
+ *
+ * In `immediate` mode, the derived data is recomputed at once.  Otherwise, it
+ * is only marked as outdated.
+ */
+
+ELLIPSE_INLINE void Ellipse :: update (void)
+{
+    if (this -> caching == Ellipse :: immediate)
+        this -> refresh ();
+    else
+        this -> cached = false;
+
+    return;
+}
+
+/******************************************************************************/
@@ -86,6 +86,8 @@ files.source        = [files.source ' ./README.md '];
 files.source        = [files.source files.newpage];
 files.source        = [files.source ' ./lib/README.md '];
 files.source        = [files.source files.newpage];
+files.source        = [files.source ' ./bench/README.md '];
+files.source        = [files.source files.newpage];
 files.source        = [files.source files.license];
 files.source        = [files.source files.newpage];
 